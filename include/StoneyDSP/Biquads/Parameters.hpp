@@ -27,18 +27,143 @@
 
 #include "StoneyDSP/Biquads.hpp"
 
+/**
+ * @brief The number of filter bands generated by the parameter layout and the
+ * processor wrappers. Override at configure time with
+ * ```-DSTONEYDSP_BIQUADS_NUM_BANDS=<n>``` (from 1 to 24).
+ */
+#ifndef STONEYDSP_BIQUADS_NUM_BANDS
+ #define STONEYDSP_BIQUADS_NUM_BANDS 4
+#endif
+
 namespace StoneyDSP {
 /** @addtogroup StoneyDSP @{ */
 
 namespace Biquads {
 /** @addtogroup Biquads @{ */
 
-class AudioPluginAudioProcessorParameters
+class AudioPluginAudioProcessorParameters : private juce::AudioProcessorValueTreeState::Listener
 {
 public:
+    //==========================================================================
+    /** The number of filter bands. */
+    static constexpr std::size_t numBands = static_cast<std::size_t>(STONEYDSP_BIQUADS_NUM_BANDS);
+
+    static_assert(numBands > 0 && numBands <= 24, "STONEYDSP_BIQUADS_NUM_BANDS must be between 1 and 24.");
+
+    /**
+     * @brief The number of stored band settings that the "Morph" parameter
+     * sweeps across, from the first (0%) to the last (100%).
+     */
+    static constexpr std::size_t numMorphSnapshots = 2;
+
+    static_assert(numMorphSnapshots >= 2, "Morphing needs at least two snapshots.");
+
+    /** The range of a band's "gain" parameter, as linear gains: about +/-24.08dB. */
+    static constexpr float minGain = 0.0625f;
+    static constexpr float maxGain = 16.0f;
+
+    //==========================================================================
+    /** A plain copy of one band's parameter values. */
+    struct BandSnapshot
+    {
+        bool    bypass      = false;
+        float   frequency   = 632.455f;
+        float   resonance   = 0.10f;
+        float   gain        = 0.00f;
+        int     type        = 12;
+        bool    dynamic     = false;
+        float   threshold   = -24.00f;
+        float   ratio       = 2.00f;
+        float   lfoDepth    = 0.00f;
+        float   lfoRate     = 1.00f;
+        int     lfoShape    = 0;
+        int     lfoSync     = 0;
+        int     channel     = 0;
+        int     slope       = 0;
+        int     os          = 2;
+    };
+
+    /**
+     * @brief A plain copy of every parameter value, filled in one go by
+     * ```getSnapshot()``` so that the audio thread works from a single,
+     * consistent view of the parameters for the whole block.
+     */
+    struct Snapshot
+    {
+        bool    bypass      = false;
+        float   output      = 0.00f;
+        float   mix         = 100.00f;
+        int     os          = 0;
+        int     transform   = 3;
+        float   attack      = 10.00f;
+        float   release     = 100.00f;
+        float   morph       = 0.00f;
+        int     stereo      = 0;
+        int     phase       = 0;
+        int     design      = 0;
+        int     governor    = 0;
+        int     offline     = 0;
+
+        std::array<BandSnapshot, numBands> bands {};
+
+        /**
+         * True once every morph snapshot has been stored, in which case the
+         * frequency, resonance, gain and type of each band come from
+         * ```morphBands``` rather than ```bands```.
+         */
+        bool            morphing        = false;
+        juce::uint32    morphVersion    = 0;
+
+        std::array<std::array<BandSnapshot, numBands>, numMorphSnapshots> morphBands {};
+    };
+
     //==========================================================================
     /** Constructor. */
     AudioPluginAudioProcessorParameters(AudioPluginAudioProcessor& p);
+    /** Destructor. */
+    ~AudioPluginAudioProcessorParameters() override;
+
+    //==========================================================================
+    /**
+     * @brief Returns the display name of a band, i.e. "A", "B", "C"...
+     *
+     * @param band the zero-based band index.
+     */
+    static juce::String getBandName(std::size_t band);
+
+    /**
+     * @brief Returns the parameter ID of a band parameter, i.e.
+     * ```getBandParameterID(0, "frequency")``` returns "Band_A_frequencyID".
+     *
+     * @param band the zero-based band index.
+     * @param parameterName the parameter name, without prefix or suffix.
+     */
+    static juce::String getBandParameterID(std::size_t band, const char* parameterName);
+
+    /**
+     * @brief Returns the length of one LFO cycle in quarter-note beats for a
+     * value of a band's "lfoSync" parameter, or zero for free-running.
+     *
+     * @param lfoSync the index of the chosen "lfoSync" option.
+     */
+    static double getLfoSyncBeats(int lfoSync) noexcept;
+
+    /**
+     * @brief Returns the slope in dB/octave for a value of a band's "slope"
+     * parameter, and whether it is a Linkwitz-Riley (rather than Butterworth)
+     * slope. Only the LP2 and HP2 types use it.
+     *
+     * @param slope the index of the chosen "slope" option.
+     * @param isLinkwitzRiley receives true for the "LR" options.
+     */
+    static int getSlopeDecibels(int slope, bool& isLinkwitzRiley) noexcept;
+
+    /**
+     * @brief Returns the lowest value of a band's "gain" parameter, in
+     * Decibels; ```minGain``` as the parameter's range has it.
+     */
+    static float getMinGainDecibels() noexcept;
 
     //==========================================================================
 
@@ -54,6 +179,45 @@ public:
      */
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
+    //==========================================================================
+    /**
+     * @brief Returns a sequence number that is incremented whenever any
+     * parameter changes. Callers compare it with the number they last saw and
+     * only call ```getSnapshot()``` when it differs.
+     */
+    juce::uint32 getVersion() const noexcept { return version.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Copies the current value of every parameter into a snapshot.
+     * Lock-free and allocation-free; safe to call from the audio thread.
+     *
+     * @param snapshot the snapshot to fill.
+     */
+    void getSnapshot(Snapshot& snapshot) const noexcept;
+
+    //==========================================================================
+    /**
+     * @brief Stores the current frequency, resonance, gain and type of every
+     * band as one of the morph snapshots. The snapshots are saved with the
+     * rest of the plugin state. Call from the message thread.
+     *
+     * @param slot the snapshot to store, from 0 to ```numMorphSnapshots - 1```.
+     */
+    void storeMorphSnapshot(std::size_t slot);
+
+    /** Forgets every morph snapshot, which switches morphing off. */
+    void clearMorphSnapshots();
+
+    /** Returns true if the given morph snapshot has been stored. */
+    bool hasMorphSnapshot(std::size_t slot) const noexcept;
+
+    /**
+     * @brief Reloads the morph snapshots from the state tree, after it has
+     * been replaced by ```setStateInformation()```. Call from the message
+     * thread.
+     */
+    void restoreMorphSnapshots();
+
     //==============================================================================
     juce::UndoManager& getUndoManager() { return undoManager; }
     //==============================================================================
@@ -71,6 +235,63 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState> apvtsPtr                { nullptr };
     juce::AudioProcessorValueTreeState& apvts;
 
+    //==========================================================================
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+
+    template <typename Function>
+    static void forEachParameterID(Function&& function);
+
+    /** Publishes a change to the morph snapshots. */
+    void morphSnapshotsChanged() noexcept;
+
+    //==========================================================================
+    /** Raw parameter values, looked up once by ID. */
+    std::atomic<float>* masterBypassValue       { nullptr };
+    std::atomic<float>* masterOutputValue       { nullptr };
+    std::atomic<float>* masterMixValue          { nullptr };
+    std::atomic<float>* masterOsValue           { nullptr };
+    std::atomic<float>* masterTransformValue    { nullptr };
+    std::atomic<float>* masterAttackValue       { nullptr };
+    std::atomic<float>* masterReleaseValue      { nullptr };
+    std::atomic<float>* masterMorphValue        { nullptr };
+    std::atomic<float>* masterStereoValue       { nullptr };
+    std::atomic<float>* masterPhaseValue        { nullptr };
+    std::atomic<float>* masterDesignValue       { nullptr };
+    std::atomic<float>* masterGovernorValue     { nullptr };
+    std::atomic<float>* masterOfflineValue      { nullptr };
+
+    std::array<std::atomic<float>*, numBands> bandBypassValue       {};
+    std::array<std::atomic<float>*, numBands> bandFrequencyValue    {};
+    std::array<std::atomic<float>*, numBands> bandResonanceValue    {};
+    std::array<std::atomic<float>*, numBands> bandGainValue         {};
+    std::array<std::atomic<float>*, numBands> bandTypeValue         {};
+    std::array<std::atomic<float>*, numBands> bandDynamicValue      {};
+    std::array<std::atomic<float>*, numBands> bandThresholdValue    {};
+    std::array<std::atomic<float>*, numBands> bandRatioValue        {};
+    std::array<std::atomic<float>*, numBands> bandLfoDepthValue     {};
+    std::array<std::atomic<float>*, numBands> bandLfoRateValue      {};
+    std::array<std::atomic<float>*, numBands> bandLfoShapeValue     {};
+    std::array<std::atomic<float>*, numBands> bandLfoSyncValue      {};
+    std::array<std::atomic<float>*, numBands> bandChannelValue      {};
+    std::array<std::atomic<float>*, numBands> bandSlopeValue        {};
+    std::array<std::atomic<float>*, numBands> bandOsValue           {};
+
+    /** The stored morph snapshots, written by the message thread only. */
+    struct MorphSnapshot
+    {
+        std::atomic<bool> stored { false };
+
+        std::array<std::atomic<float>, numBands> frequency;
+        std::array<std::atomic<float>, numBands> resonance;
+        std::array<std::atomic<float>, numBands> gain;
+        std::array<std::atomic<int>, numBands> type;
+    };
+
+    std::array<MorphSnapshot, numMorphSnapshots> morphSnapshots;
+
+    std::atomic<juce::uint32> version { 1 };
+    std::atomic<juce::uint32> morphVersion { 1 };
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioPluginAudioProcessorParameters)
 };
 
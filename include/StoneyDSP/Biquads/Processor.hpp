@@ -31,9 +31,12 @@ namespace StoneyDSP {
 namespace Biquads {
 /** @addtogroup Biquads @{ */
 
-class AudioPluginAudioProcessor final : public juce::AudioProcessor
+class AudioPluginAudioProcessor final : public juce::AudioProcessor, private juce::Timer
 {
 public:
+    //==============================================================================
+    /** The widest main bus accepted: 16 channels, for third-order ambisonics. */
+    static constexpr int maxNumChannels = 16;
     //==============================================================================
     AudioPluginAudioProcessor();
     ~AudioPluginAudioProcessor() override;
@@ -84,13 +87,89 @@ public:
     juce::dsp::ProcessSpec& getSpec() { return spec; }
     //==============================================================================
     const AudioPluginAudioProcessorParameters& getParameters() { return parameters; }
+    //==============================================================================
+    /** Stores the current band settings as morph snapshot "slot" (0 is A, 1 is B...). */
+    void storeMorphSnapshot(std::size_t slot) { parameters.storeMorphSnapshot(slot); }
+    void clearMorphSnapshots() { parameters.clearMorphSnapshots(); }
+    bool hasMorphSnapshot(std::size_t slot) const noexcept { return parameters.hasMorphSnapshot(slot); }
+    //==============================================================================
+    /**
+     * @brief Returns the quality tier that the governor has chosen, from 0
+     * (full quality) up; always 0 while the "Governor" parameter is off.
+     * Safe to call from any thread.
+     */
+    int getQualityTier() const noexcept { return governor.getTier(); }
+    /** Returns the averaged process time over the block deadline, if governed. */
+    float getProcessLoad() const noexcept { return governor.getLoad(); }
+    /**
+     * @brief Returns true while the wrapper of the other precision to the
+     * host's is running: single precision for a governed double-precision
+     * host, or double precision for a single-precision host rendering
+     * offline at the best quality.
+     */
+    bool isUsingMixedPrecision() const noexcept { return isMixedPrecision; }
+    /**
+     * @brief Returns true if the running wrapper takes its fast path for
+     * blocks of up to 32 samples, for as long as no parameter changes.
+     */
+    bool isUsingTinyBlockPath() const noexcept;
 
 private:
     //==============================================================================
-    AudioPluginAudioProcessorWrapper<float>& getProcessorFlt() { return processorFlt; }
-    AudioPluginAudioProcessorWrapper<double>& getProcessorDbl() { return processorDbl; }
-    //==============================================================================
-    juce::AudioProcessor::ProcessingPrecision processingPrecision;
+    AudioPluginAudioProcessorWrapper<float>& getProcessorFlt() { jassert(processorFltPtr != nullptr); return *processorFltPtr; }
+    AudioPluginAudioProcessorWrapper<double>& getProcessorDbl() { jassert(processorDblPtr != nullptr); return *processorDblPtr; }
+    /**
+     * @brief Creates the wrapper for the current precision, if it doesn't
+     * exist yet, and frees the other one. Call from the message thread only,
+     * while the audio isn't running.
+     */
+    void updateProcessor();
+    /**
+     * @brief Makes and prepares the wrapper for the new precision, hands it
+     * the state of the current one at the switch, and frees the old one, so
+     * that playback carries on without a reset. Message thread only.
+     */
+    template <typename OldSampleType, typename NewSampleType>
+    void switchProcessor(std::unique_ptr<AudioPluginAudioProcessorWrapper<OldSampleType>>& oldProcessor,
+                         std::unique_ptr<AudioPluginAudioProcessorWrapper<NewSampleType>>& newProcessor,
+                         juce::AudioProcessor::ProcessingPrecision newPrecision,
+                         bool newMixedPrecision = false);
+    /**
+     * @brief Runs a wrapper over a buffer. In real time, it is handed the
+     * governor's tier beforehand and timed for the governor afterwards, if
+     * the "Governor" parameter is on.
+     */
+    template <typename SampleType>
+    void processWrapper(AudioPluginAudioProcessorWrapper<SampleType>& processor, juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages);
+    /**
+     * @brief Runs the wrapper of the other precision over the host's buffer,
+     * through a buffer of its own precision.
+     */
+    template <typename HostSampleType, typename SampleType>
+    void processMixedPrecision(juce::AudioBuffer<HostSampleType>& buffer, juce::AudioBuffer<SampleType>& mixedBuffer, AudioPluginAudioProcessorWrapper<SampleType>& processor, juce::MidiBuffer& midiMessages);
+    /**
+     * @brief Switches to the wrapper of the precision that the governor or
+     * the offline quality path calls for, makes the offline pool the first
+     * time that it is needed, and switches the wrapper's offline quality
+     * path on or off. Message thread only.
+     */
+    void updateProcessingMode();
+    /**
+     * @brief Switches a wrapper's offline quality path on or off, under the
+     * callback lock, if it isn't already. Message thread only.
+     */
+    template <typename SampleType>
+    void updateOfflineQuality(AudioPluginAudioProcessorWrapper<SampleType>& processor, bool isOffline);
+    /**
+     * Calls ```updateProcessingMode()```, for the governor's requests and
+     * for the host's ```setNonRealtime()```, which may come from any thread;
+     * ```prepareToPlay()``` picks the latter up too. With
+     * ```STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE```, it also brings the
+     * LFO bands' coefficient tables up to date with their settings.
+     */
+    void timerCallback() override;
+    //==============================================================================
+    juce::AudioProcessor::ProcessingPrecision processingPrecision { singlePrecision };
     juce::dsp::ProcessSpec spec;
     //==============================================================================
     std::unique_ptr<AudioPluginAudioProcessorParameters> parametersPtr { nullptr };
@@ -99,13 +178,35 @@ private:
     juce::UndoManager& undoManager;
     juce::AudioProcessorValueTreeState& apvts;
     //==============================================================================
+    /** Only the wrapper for the current precision exists; see ```updateProcessor()```. */
     std::unique_ptr<AudioPluginAudioProcessorWrapper<float>> processorFltPtr { nullptr };
     std::unique_ptr<AudioPluginAudioProcessorWrapper<double>> processorDblPtr { nullptr };
     //==============================================================================
-    AudioPluginAudioProcessorWrapper<float>& processorFlt;
-    AudioPluginAudioProcessorWrapper<double>& processorDbl;
+    /**
+     * Picks the quality tier from the process time of each block; see
+     * ```AudioPluginAudioProcessorWrapper::setQualityTier()```.
+     */
+    StoneyDSP::Audio::QualityGovernor governor;
+    /**
+     * Set by the audio thread when the tier calls for mixed precision; the
+     * switch is made (or undone) by ```updateProcessingMode()```. While
+     * mixed, the host's buffer is copied through the buffer of the other
+     * precision.
+     */
+    std::atomic<bool> wantsMixedPrecision { false };
+    bool isMixedPrecision = false;
+    juce::AudioBuffer<float> mixedPrecisionFltBuffer;
+    juce::AudioBuffer<double> mixedPrecisionDblBuffer;
+    /** Threads for wide buffers in offline renders; made when first needed. */
+    std::unique_ptr<juce::ThreadPool> offlinePool { nullptr };
+    /**
+     * Set by ```updateProcessingMode()``` while the host renders offline;
+     * the audio thread only reads it, to leave the governor out.
+     */
+    std::atomic<bool> isRenderingOffline { false };
     //==============================================================================
     juce::AudioParameterBool* bypassState { nullptr };
+    juce::AudioParameterChoice* offlineState { nullptr };
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioPluginAudioProcessor)
 };
@@ -25,6 +25,81 @@
 #pragma once
 #define STONEYDSP_BIQUADS_WRAPPER_HPP_INCLUDED
 
+#ifndef STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+ #define STONEYDSP_BIQUADS_USING_DESIGN_SERVICE 0
+#endif
+
+/**
+ * @brief The number of samples between updates of the modulated (dynamic or
+ * LFO) bands. Override at configure time with
+ * ```-DSTONEYDSP_BIQUADS_CONTROL_BLOCK_SIZE=<n>```.
+ */
+#ifndef STONEYDSP_BIQUADS_CONTROL_BLOCK_SIZE
+ #define STONEYDSP_BIQUADS_CONTROL_BLOCK_SIZE 32
+#endif
+
+#ifndef STONEYDSP_BIQUADS_USING_SHARED_COEFFICIENT_CACHE
+ #define STONEYDSP_BIQUADS_USING_SHARED_COEFFICIENT_CACHE 0
+#endif
+
+/**
+ * @brief If set, bands that are only swept by their LFO look their
+ * coefficients up from a ```StoneyDSP::Audio::BiquadsCoefficientTable```
+ * instead of re-designing them. Override at configure time with
+ * ```-DSTONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE=ON```.
+ */
+#ifndef STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+ #define STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE 0
+#endif
+
+/**
+ * @brief The first partition of the linear-phase convolution, in samples, for
+ * non-uniform partitioning; 0 partitions uniformly by the block size. 512 has
+ * the lowest worst case over block sizes of 32 to 1024 (see the LinearPhase
+ * benchmark). Override at configure time with
+ * ```-DSTONEYDSP_BIQUADS_LINEAR_PHASE_HEAD_SIZE=<n>```.
+ */
+#ifndef STONEYDSP_BIQUADS_LINEAR_PHASE_HEAD_SIZE
+ #define STONEYDSP_BIQUADS_LINEAR_PHASE_HEAD_SIZE 512
+#endif
+
+/**
+ * @brief The highest frequency that a band set to "Auto" oversampling can
+ * reach before it is oversampled, in percent of Nyquist. Override at
+ * configure time with ```-DSTONEYDSP_BIQUADS_AUTO_OVERSAMPLING_THRESHOLD=<n>```.
+ */
+#ifndef STONEYDSP_BIQUADS_AUTO_OVERSAMPLING_THRESHOLD
+ #define STONEYDSP_BIQUADS_AUTO_OVERSAMPLING_THRESHOLD 25
+#endif
+
+/**
+ * @brief How long a band takes to fade from its old filter type to its new
+ * one, in milliseconds; 0 resets the band instead. Override at configure time
+ * with ```-DSTONEYDSP_BIQUADS_TYPE_CROSSFADE_TIME=<n>```.
+ */
+#ifndef STONEYDSP_BIQUADS_TYPE_CROSSFADE_TIME
+ #define STONEYDSP_BIQUADS_TYPE_CROSSFADE_TIME 10
+#endif
+
+/**
+ * @brief The size of the blocks that the host's blocks are re-blocked into
+ * before they are processed, in samples; 0 processes them as they come.
+ * Override at configure time with ```-DSTONEYDSP_BIQUADS_REBLOCK_SIZE=<n>```.
+ */
+#ifndef STONEYDSP_BIQUADS_REBLOCK_SIZE
+ #define STONEYDSP_BIQUADS_REBLOCK_SIZE 0
+#endif
+
+/**
+ * @brief 1 to re-block through a FIFO, with one block of latency, so that
+ * every block is full-size; 0 to split the host's blocks with no latency,
+ * leaving a shorter block at the end of each. Override at configure time with
+ * ```-DSTONEYDSP_BIQUADS_REBLOCK_FIXED_LATENCY=1```.
+ */
+#ifndef STONEYDSP_BIQUADS_REBLOCK_FIXED_LATENCY
+ #define STONEYDSP_BIQUADS_REBLOCK_FIXED_LATENCY 0
+#endif
+
 namespace StoneyDSP {
 /** @addtogroup StoneyDSP @{ */
 
@@ -58,6 +133,16 @@ public:
     void reset(SampleType initialValue = { 0.0 });
     void snapToZero() noexcept;
 
+    /**
+     * @brief Takes over the band states, glides, LFO phases and morph of the
+     * wrapper of the other precision, when the host switches precision. This
+     * one must already be prepared with the same spec; nothing is allocated.
+     * The envelope follower, the oversamplers and the linear-phase
+     * convolution start again from silence.
+     */
+    template <typename OtherSampleType>
+    void copyStateFrom(const AudioPluginAudioProcessorWrapper<OtherSampleType>& other) noexcept;
+
     //==============================================================================
     /**
      * @brief
@@ -128,19 +213,260 @@ public:
     // }
 
     //==============================================================================
-    /** Updates the internal state variables of the processor. */
+    /**
+     * @brief Updates the internal state variables of the processor, if any
+     * parameter has changed since the last call.
+     */
     void update();
 
     //==============================================================================
     /** Sets the oversampling factor. */
     void setOversampling();
 
+    /** Returns the latency of the wet path, in samples. */
     SampleType getLatencySamples() const noexcept;
 
+    /**
+     * @brief Returns true if blocks of up to 32 samples take
+     * ```processTinyBlock()``` for as long as no parameter changes.
+     */
+    bool isUsingTinyBlockPath() const noexcept { return isTinyBlockReady; }
+
+    //==============================================================================
+    /** Returns true if the "Governor" parameter is on. */
+    bool isGovernorOn() const noexcept { return snapshot.governor != 0; }
+
+    /**
+     * @brief Returns the number of quality tiers below full quality that the
+     * governor can step down through with the current settings: one for each
+     * halving of the oversampling factor, then one for mixed precision (if
+     * ```canLowerPrecision```, and not in linear-phase mode), then
+     * ```numControlRateTiers``` for the modulated bands.
+     */
+    int getNumQualityTiers(bool canLowerPrecision) const noexcept;
+
+    /**
+     * @brief Moves to a quality tier from the governor. A change of
+     * oversampling fades the wet signal out and back in over the mixer's
+     * glide, with the latency held where the "Oversampling" parameter puts
+     * it; the modulated bands simply update less often.
+     *
+     * @return true if the tier calls for mixed precision, which the processor
+     * carries out itself, once any change of oversampling is over.
+     */
+    bool setQualityTier(int tier, bool canLowerPrecision) noexcept;
+
+    //==============================================================================
+    /**
+     * @brief Switches the offline quality path on or off, for non-realtime
+     * renders. While on, every band that may be oversampled runs at 16x, the
+     * modulated bands are updated every sample, and every design is made
+     * here on the audio thread, so that a render never depends on the timing
+     * of the design thread. Blocks of more than one group of
+     * ```laneGroupSize``` channels are split across the threads of the pool,
+     * if one is given, a group per thread, with the jobs made in
+     * ```prepare()```; only ever give one in a non-realtime render.
+     *
+     * Moving the bands to their new rates designs every one of them, so call
+     * from the message thread only, under the processor's callback lock.
+     */
+    void setOfflineQuality(bool shouldUseOfflineQuality, juce::ThreadPool* pool);
+
+    /** Returns true while the offline quality path is on; see ```setOfflineQuality()```. */
+    bool isUsingOfflineQuality() const noexcept { return isOfflineQuality; }
+
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+    /**
+     * @brief Gives each band that is only swept by its LFO a coefficient
+     * table for the type, resonance, gain and rate it now runs at, shared
+     * with any other band (or instance) that has the same, and lets go of
+     * the tables that no band needs any more. Allocates, so call it from the
+     * message thread: ```prepare()``` calls it, and the processor's timer
+     * after that. The tables are handed over under the processor's callback
+     * lock; until a band has one that matches, it re-designs as usual.
+     */
+    void updateCoefficientTables();
+#endif
+
 private:
     //==============================================================================
     AudioPluginAudioProcessorWrapper() = delete;
 
+    /**
+     * @brief Applies the current snapshot to the mixer and the bands.
+     *
+     * @param designOnThisThread if true, coefficients are designed right here;
+     * otherwise they are handed to the design service (when enabled).
+     */
+    void applySnapshot(bool designOnThisThread);
+
+    /**
+     * @brief Returns the number of times ```arena``` and every band's own
+     * arena (and type crossfade) have gone to the heap. The audio thread
+     * checks it against ```numAllocations``` after each block and each
+     * snapshot it applies.
+     */
+    int getNumAllocations() const noexcept;
+
+    /**
+     * @brief Runs the envelope follower over one control block of the
+     * detector signal (if any band is dynamic), then moves the frequency and
+     * gain of every modulated band to suit and advances their LFOs and the
+     * morph.
+     */
+    void updateModulatedBands(const juce::dsp::AudioBlock<SampleType>& detectorBlock) noexcept;
+
+    /**
+     * @brief Runs every active band over the context: all channels alike in
+     * "Linked" mode, or each band on its own channel(s) of a stereo pair in
+     * "Mid/Side" and "Left/Right" mode.
+     */
+    void processBands(const juce::dsp::ProcessContextReplacing<SampleType>& context) noexcept;
+
+    /**
+     * @brief Runs the active bands from ```first``` up to (but not including)
+     * ```last``` over the context, all at one rate.
+     */
+    void processBandRange(const juce::dsp::ProcessContextReplacing<SampleType>& context, std::size_t first, std::size_t last) noexcept;
+
+    /**
+     * @brief Runs the bands as ```processBandRange()``` does, with each group
+     * of channels handed to one of ```bandGroupJobs``` on the offline pool,
+     * and waits for them all. The caller blocks, so this is never taken
+     * while ```isRealtime()```: there is only a pool in non-realtime renders.
+     *
+     * @return false, having done nothing, if the block is too small or too
+     * narrow to be worth it, or if any of the bands is gliding.
+     */
+    bool processBandRangeInParallel(const juce::dsp::ProcessContextReplacing<SampleType>& context, std::size_t first, std::size_t last);
+
+    /**
+     * @brief Runs the active bands from ```first``` up to (but not including)
+     * ```last``` over one group of channels, from ```firstChannel``` on.
+     */
+    void processBandGroup(juce::dsp::AudioBlock<SampleType> groupBlock, std::size_t firstChannel, std::size_t first, std::size_t last) noexcept;
+
+    /** One group of channels of a block, for ```processBandRangeInParallel()```. */
+    class BandGroupJob : public juce::ThreadPoolJob
+    {
+    public:
+        explicit BandGroupJob(AudioPluginAudioProcessorWrapper& owner)
+        : juce::ThreadPoolJob("Biquads band group")
+        , wrapper(owner)
+        {}
+
+        JobStatus runJob() override
+        {
+            juce::ScopedNoDenormals noDenormals;
+
+            wrapper.processBandGroup(groupBlock, firstChannel, first, last);
+            return jobHasFinished;
+        }
+
+        juce::dsp::AudioBlock<SampleType> groupBlock;
+        std::size_t firstChannel = 0, first = 0, last = 0;
+
+    private:
+        AudioPluginAudioProcessorWrapper& wrapper;
+    };
+
+    /**
+     * @brief Runs the main channels of a tiny block through every active
+     * band and the mix in one pass, sample by sample; only while
+     * ```isTinyBlockReady```.
+     */
+    void processTinyBlock(juce::AudioBuffer<SampleType>& buffer) noexcept;
+
+    /**
+     * @brief Works out, after a block has been through the full path,
+     * whether the next tiny blocks can take ```processTinyBlock()```: every
+     * active band runs at the base rate, unmodulated, linked and not
+     * gliding, with nothing to delay, no mix to glide and no quality change
+     * under way.
+     */
+    void updateTinyBlockPath() noexcept;
+
+    /**
+     * @brief Returns true if a band should run in the oversampled group: it
+     * is set to "Always", or to "Auto" and can reach above the threshold.
+     */
+    bool isOversampledBand(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) const noexcept;
+
+    /**
+     * @brief Moves a band to a new sample rate, when it joins or leaves the
+     * oversampled group. Only allocates if the channel count has changed.
+     */
+    void prepareBand(std::size_t band, double newSampleRate);
+
+    /**
+     * @brief Returns true if a band runs through its cascade instead of its
+     * Biquads, i.e. it is an LP2 or HP2 band steeper than 12dB/octave.
+     */
+    static bool isCascadeBand(const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) noexcept;
+
+    /** Moves a cascade band to its type, slope and the given frequency. */
+    void updateCascade(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot, SampleType frequency) noexcept;
+
+    /**
+     * @brief Adds the sections of a band to the linear-phase kernel's
+     * sections.
+     */
+    void addLinearPhaseSections(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) noexcept;
+
+    /**
+     * @brief Passes the wet path's latency on to the mixer and the host, if
+     * it has changed.
+     */
+    void updateLatency(bool force) noexcept;
+
+    /** Carries on a change of oversampling that the governor has asked for. */
+    void updateQuality() noexcept;
+
+    /** Reads the host tempo and position, and locks synced LFOs to them. */
+    void updateTransport() noexcept;
+
+    /** Returns an LFO's output, from -1 to 1, at a phase from 0 to 1. */
+    static SampleType getLfoValue(int shape, double phase) noexcept;
+
+    /**
+     * @brief Designs the end-points of the morph, whenever the snapshots or
+     * the sample rate change.
+     */
+    void prepareMorph();
+
+    /**
+     * @brief Replaces the frequency, resonance, gain and type of a band with
+     * their values at the current morph position: frequency is interpolated
+     * in octaves, resonance and gain linearly, and the type switches half-way.
+     *
+     * @return the index of the snapshot that the band sits exactly on, whose
+     * coefficients are already designed, or -1 if it is between two.
+     */
+    int getMorphedBand(std::size_t band, AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) const noexcept;
+
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+    /**
+     * @brief Returns true if a band can take its coefficients from a table:
+     * it is swept by its LFO alone, not steep and not morphed, and is
+     * designed with the bilinear transform, as the tables are.
+     */
+    bool isTableBand(std::size_t band) const noexcept;
+    /** Returns the band's table, if it has one for its current settings. */
+    const StoneyDSP::Audio::BiquadsCoefficientTable<SampleType>* getCoefficientTable(std::size_t band) const noexcept;
+#endif
+
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    /** Queues a design for a band, if its settings have changed. */
+    void requestDesign(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot);
+    /**
+     * @brief Glides each band towards any designs that have come back, or
+     * crossfades to them if they are for a new filter type.
+     *
+     * @return true if any design came back.
+     */
+    bool collectDesigns() noexcept;
+#endif
+
     //==============================================================================
     // This reference is provided as a quick way for the wrapper to
     // access the processor object that created it.
@@ -149,50 +475,203 @@ private:
     juce::dsp::ProcessSpec& setup;
 
     //==============================================================================
-    // std::unique_ptr<juce::dsp::Oversampling<SampleType>> oversampler[5];
-    std::unique_ptr<juce::dsp::DryWetMixer<SampleType>> mixer;
+    /**
+     * One oversampler for each "Oversampling" factor from 2x (index 1) up to
+     * 16x (index 4), all made ready in ```prepare()```; index 0 is unused.
+     */
+    std::unique_ptr<juce::dsp::Oversampling<SampleType>> oversampler[5];
+    std::unique_ptr<StoneyDSP::Audio::DryWetMixer<SampleType>> mixer;
+
+    /** The oversampler in use, or 0 for none. */
+    int oversamplingIndex = 0;
 
-    const std::size_t biquadArraySize;
-    std::unique_ptr<StoneyDSP::Audio::Biquads<SampleType>> biquadArray[4];
+    /**
+     * The oversampler that the parameters ask for, or 0 for none, before the
+     * governor has had its say; the latency is always that of this one.
+     */
+    int requestedOversamplingIndex = 0;
+
+    /** Halvings of the oversampling factor asked for by the governor, and in effect. */
+    int requestedOversamplingReduction = 0;
+    int oversamplingReduction = 0;
+    bool isChangingOversampling = false;
+
+    /** The number of filter bands. */
+    static constexpr std::size_t biquadArraySize = AudioPluginAudioProcessorParameters::numBands;
+
+    /**
+     * The band pool, held in place; the state of every band is carved from
+     * ```arena``` when they are prepared together.
+     */
+    std::array<StoneyDSP::Audio::Biquads<SampleType>, biquadArraySize> biquadArray;
+
+    /** Indices of the bands that are switched on, rebuilt in ```update()```. */
+    std::array<std::size_t, biquadArraySize> activeBands {};
+    std::size_t numActiveBands = 0;
+    std::array<bool, biquadArraySize> bandWasActive {};
+
+    /** Steep LP/HP chains, used in place of the Biquads of a cascade band. */
+    std::array<StoneyDSP::Audio::BiquadsCascade<SampleType>, biquadArraySize> cascadeArray;
+    std::array<bool, biquadArraySize> bandIsCascade {};
+
+    /** ```BiquadsStereoFlags``` for each active band, for ```processBands()```. */
+    std::array<int, biquadArraySize> activeBandFlags {};
+
+    /**
+     * The active bands that run at the base rate come first in
+     * ```activeBands```; the rest run in the oversampled group.
+     */
+    std::size_t numBaseRateBands = 0;
+
+    /** The rate that each band is prepared for. */
+    std::array<double, biquadArraySize> bandSampleRate {};
+
+    /**
+     * One block for the state of every band and the mixer's buffers, from
+     * ```prepare()```, and the number of times it and the bands' own arenas
+     * had gone to the heap at the end of the last ```prepare()```,
+     * ```copyStateFrom()``` or ```setOfflineQuality()```, all on the message
+     * thread; see ```getNumAllocations()```.
+     */
+    StoneyDSP::Core::Arena arena;
+    int numAllocations = 0;
+
+    /**
+     * Hands ```processBlock()``` blocks of ```reblockSize``` samples, whatever
+     * the host's block size; its FIFO, if any, is carved from ```arena```.
+     */
+    StoneyDSP::Audio::Reblocker<SampleType> reblocker;
+
+    static constexpr std::size_t reblockSize = static_cast<std::size_t>(STONEYDSP_BIQUADS_REBLOCK_SIZE);
+    static constexpr bool isReblockFixedLatency = STONEYDSP_BIQUADS_REBLOCK_FIXED_LATENCY != 0;
+
+    /** The channel count and block size of the main bus, from ```prepare()```. */
+    juce::dsp::ProcessSpec bandSpec {};
+
+    //==========================================================================
+    using linearPhaseType = StoneyDSP::Audio::BiquadsLinearPhase<SampleType>;
+
+    /** Linear-phase FIR version of the active bands, for the "Phase" mode. */
+    std::unique_ptr<linearPhaseType> linearPhase;
+
+    /** The sections of every active band, as last sent to ```linearPhase```. */
+    std::array<StoneyDSP::Audio::BiquadsCoefficients<SampleType>, linearPhaseType::maxSections> linearPhaseSections {};
+    std::array<StoneyDSP::Audio::BiquadsCoefficients<SampleType>, linearPhaseType::maxSections> pendingSections {};
+    std::size_t numLinearPhaseSections = 0;
+    std::size_t numPendingSections = 0;
+    bool isLinearPhase = false;
+    bool linearPhaseNeedsSections = true;
+    int latencySamples = 0;
+    int wetDelaySamples = 0;
 
     //==========================================================================
-    /** Parameter pointers. */
-    juce::AudioParameterBool*       masterBypassPtr         { nullptr };
-    juce::AudioParameterFloat*      masterOutputPtr         { nullptr };
-    juce::AudioParameterFloat*      masterMixPtr            { nullptr };
-    juce::AudioParameterChoice*     masterOsPtr             { nullptr };
-    juce::AudioParameterChoice*     masterTransformPtr      { nullptr };
-
-    juce::AudioParameterBool*       biquadsABypassPtr       { nullptr };
-    juce::AudioParameterFloat*      biquadsAFrequencyPtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsAResonancePtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsAGainPtr         { nullptr };
-    juce::AudioParameterChoice*     biquadsATypePtr         { nullptr };
-
-    juce::AudioParameterBool*       biquadsBBypassPtr       { nullptr };
-    juce::AudioParameterFloat*      biquadsBFrequencyPtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsBResonancePtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsBGainPtr         { nullptr };
-    juce::AudioParameterChoice*     biquadsBTypePtr         { nullptr };
-
-    juce::AudioParameterBool*       biquadsCBypassPtr       { nullptr };
-    juce::AudioParameterFloat*      biquadsCFrequencyPtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsCResonancePtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsCGainPtr         { nullptr };
-    juce::AudioParameterChoice*     biquadsCTypePtr         { nullptr };
-
-    juce::AudioParameterBool*       biquadsDBypassPtr       { nullptr };
-    juce::AudioParameterFloat*      biquadsDFrequencyPtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsDResonancePtr    { nullptr };
-    juce::AudioParameterFloat*      biquadsDGainPtr         { nullptr };
-    juce::AudioParameterChoice*     biquadsDTypePtr         { nullptr };
-
-    juce::AudioParameterBool*       bypassState             { nullptr };
+    /** Sidechain envelope follower for the dynamic bands. */
+    std::unique_ptr<juce::dsp::BallisticsFilter<SampleType>> envelope;
+
+    /** Indices of the active bands that are dynamic and/or have an LFO. */
+    std::array<std::size_t, biquadArraySize> modulatedBands {};
+    std::size_t numModulatedBands = 0;
+    std::size_t numDynamicBands = 0;
+    std::array<bool, biquadArraySize> bandWasModulated {};
+
+    /** LFO phase of each band, from 0 to 1. */
+    std::array<double, biquadArraySize> lfoPhase {};
+
+    /** Host tempo, for synced LFOs. */
+    double transportBpm = 120.0;
+
+    /** The number of samples between updates of the modulated bands. */
+    static constexpr std::size_t controlBlockSize = static_cast<std::size_t>(STONEYDSP_BIQUADS_CONTROL_BLOCK_SIZE);
+
+    static_assert(controlBlockSize > 0, "STONEYDSP_BIQUADS_CONTROL_BLOCK_SIZE must be at least 1.");
+
+    /**
+     * The governor's last tiers double the control block size, once for
+     * each; ```controlRateTier``` is how many times it is doubled now.
+     */
+    static constexpr int numControlRateTiers = 2;
+    int controlRateTier = 0;
+
+    //==========================================================================
+    /** The offline quality path, and its pool; see ```setOfflineQuality()```. */
+    bool isOfflineQuality = false;
+    juce::ThreadPool* offlinePool = nullptr;
+
+    /** A job for each group of main channels, made in ```prepare()```. */
+    std::vector<std::unique_ptr<BandGroupJob>> bandGroupJobs;
+
+    /** The fewest samples in a block that are worth splitting across threads. */
+    static constexpr std::size_t minParallelBlockSize = 256;
+
+    /**
+     * Blocks of up to ```maxTinyBlockSize``` samples skip the full path while
+     * ```isTinyBlockReady```, which any new snapshot clears.
+     */
+    static constexpr int maxTinyBlockSize = 32;
+    bool isTinyBlockReady = false;
+    /**
+     * The envelope follower has a channel for every main channel, or two for
+     * a stereo sidechain on a mono bus; set in ```prepare()```.
+     */
+    juce::uint32 numDetectorChannels = 2;
+
+    //==========================================================================
+    static constexpr std::size_t numMorphSnapshots = AudioPluginAudioProcessorParameters::numMorphSnapshots;
+
+    /** The coefficients of every band at each morph snapshot. */
+    std::array<std::array<StoneyDSP::Audio::BiquadsCoefficients<SampleType>, biquadArraySize>, numMorphSnapshots> morphCoefficients {};
+
+    /** ln(frequency ratio) of every band between neighbouring snapshots. */
+    std::array<std::array<SampleType, biquadArraySize>, numMorphSnapshots - 1> morphLogRatio {};
+
+    /** Morph position from 0 to 1, glided towards the "Morph" parameter. */
+    SampleType morphPosition = 0.0;
+    SampleType morphTarget = 0.0;
+    SampleType morphStep = 0.0;
+    int morphSamplesRemaining = 0;
+    bool morphNeedsUpdate = false;
+    bool wasMorphing = false;
+    juce::uint32 morphVersion = 0;
+
+    /** The "Design" method of the single bands; cascades are always bilinear. */
+    StoneyDSP::Audio::BiquadsDesignMethod designMethod = StoneyDSP::Audio::BiquadsDesignMethod::bilinear;
+
+    //==========================================================================
+    /** Parameter snapshot, refreshed only when the parameter version changes. */
+    const AudioPluginAudioProcessorParameters& parameters;
+    AudioPluginAudioProcessorParameters::Snapshot snapshot;
+    juce::uint32 snapshotVersion = 0;
+
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+    /**
+     * Each LFO band's coefficient table, if any; see ```updateCoefficientTables()```.
+     * Only swapped under the processor's callback lock.
+     */
+    std::array<std::shared_ptr<const StoneyDSP::Audio::BiquadsCoefficientTable<SampleType>>, biquadArraySize> coefficientTables;
+#endif
+
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    //==========================================================================
+    /** Background coefficient design; see ```STONEYDSP_BIQUADS_USING_DESIGN_SERVICE```. */
+    using designServiceType = StoneyDSP::Audio::BiquadsDesignService<SampleType>;
+    std::unique_ptr<designServiceType> designService;
+
+    /** The settings each band was last designed (or asked to be designed) for. */
+    std::array<typename designServiceType::Request, biquadArraySize> designedSettings {};
+
+    /** Whether the design on its way for each band is for a new filter type. */
+    std::array<bool, biquadArraySize> designChangesType {};
+
+    /** Glide length for designs that arrive from the service, in samples. */
+    int designRampLength = 0;
+#endif
 
     //==============================================================================
     /** Initialised constant */
     double sampleRate = 0.0;
 
+    template <typename> friend class AudioPluginAudioProcessorWrapper;
+
     // int curOS = 0, prevOS = 0, oversamplingFactor = 1;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioPluginAudioProcessorWrapper)
@@ -38,3 +38,12 @@
 // #include "filter/stoneydsp_Biquads.cpp"
 
 #include "widgets/stoneydsp_Biquads.cpp"
+#include "widgets/stoneydsp_BiquadsDesignService.cpp"
+#include "widgets/stoneydsp_BiquadsCoefficientTable.cpp"
+#include "widgets/stoneydsp_BiquadsCoefficientCache.cpp"
+#include "widgets/stoneydsp_BiquadsCascade.cpp"
+#include "widgets/stoneydsp_BiquadsCrossover.cpp"
+#include "widgets/stoneydsp_BiquadsLinearPhase.cpp"
+#include "widgets/stoneydsp_DryWetMixer.cpp"
+#include "widgets/stoneydsp_QualityGovernor.cpp"
+#include "widgets/stoneydsp_Reblocker.cpp"
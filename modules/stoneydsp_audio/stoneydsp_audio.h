@@ -72,3 +72,12 @@ namespace Audio
 // #include "filter/stoneydsp_Biquads.hpp"
 
 #include "widgets/stoneydsp_Biquads.hpp"
+#include "widgets/stoneydsp_BiquadsDesignService.hpp"
+#include "widgets/stoneydsp_BiquadsCoefficientTable.hpp"
+#include "widgets/stoneydsp_BiquadsCoefficientCache.hpp"
+#include "widgets/stoneydsp_BiquadsCascade.hpp"
+#include "widgets/stoneydsp_BiquadsCrossover.hpp"
+#include "widgets/stoneydsp_BiquadsLinearPhase.hpp"
+#include "widgets/stoneydsp_DryWetMixer.hpp"
+#include "widgets/stoneydsp_QualityGovernor.hpp"
+#include "widgets/stoneydsp_Reblocker.hpp"
@@ -43,12 +43,6 @@ Biquads<SampleType>::Biquads()
 , a0            (StoneyDSP::Maths::Constants<SampleType>::one)
 , a1            (StoneyDSP::Maths::Constants<SampleType>::zero)
 , a2            (StoneyDSP::Maths::Constants<SampleType>::zero)
-, b_0           (StoneyDSP::Maths::Constants<SampleType>::one)
-, b_1           (StoneyDSP::Maths::Constants<SampleType>::zero)
-, b_2           (StoneyDSP::Maths::Constants<SampleType>::zero)
-, a_0           (StoneyDSP::Maths::Constants<SampleType>::one)
-, a_1           (StoneyDSP::Maths::Constants<SampleType>::zero)
-, a_2           (StoneyDSP::Maths::Constants<SampleType>::zero)
 , loop          (StoneyDSP::Maths::Constants<SampleType>::zero)
 , outputSample  (StoneyDSP::Maths::Constants<SampleType>::zero)
 , minFrequency  (static_cast <SampleType>(20.0))
@@ -69,10 +63,6 @@ void Biquads<SampleType>::setFrequency (SampleType newFrequency)
 
     hz = juce::jlimit(minFrequency, maxFrequency, newFrequency);
 
-    omega = (hz * ((pi * two) / static_cast <SampleType>(sampleRate)));
-    cos = (std::cos(omega));
-    sin = (std::sin(omega));
-
     update(); // calculateCoefficients();
 }
 
@@ -92,14 +82,75 @@ void Biquads<SampleType>::setGain(SampleType newGain)
     update(); // calculateCoefficients();
 }
 
+template <typename SampleType>
+void Biquads<SampleType>::setGainFast(SampleType newGain) noexcept
+{
+    setParametersFast(hz, q, newGain);
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::setParametersFast(SampleType newFrequency, SampleType newResonance, SampleType newGain) noexcept
+{
+    using Functions = StoneyDSP::Maths::Functions<SampleType>;
+
+    // ln(10) / 20, since 10^(gain / 20) == e^(gain * ln(10) / 20)
+    constexpr auto nepersPerDecibel = static_cast<SampleType>(0.11512925464970228420);
+
+    const auto newHz = juce::jlimit(minFrequency, maxFrequency, newFrequency);
+    const auto newQ = juce::jlimit(zero, one, newResonance);
+
+    if (sampleRate <= 0.0)
+    {
+        hz = newHz;
+        q = newQ;
+        g = newGain;
+        return;
+    }
+
+    // The matched design has no cheap partial update.
+    if (designMethod == designMethodType::matched)
+    {
+        hz = newHz;
+        q = newQ;
+        g = newGain;
+        designTermsAreValid = false;
+
+        setCoefficients(calculateMatchedCoefficients(filterTypeParamValue, hz, q, g, sampleRate));
+        return;
+    }
+
+    if (! designTermsAreValid)
+        updateDesignTerms();
+
+    if (newHz != hz)
+    {
+        hz      = newHz;
+        omega   = (hz * ((pi * two) / static_cast <SampleType>(sampleRate)));
+        Functions::sinCos(omega, sin, cos);
+    }
+
+    q       = newQ;
+    alpha   = (sin * (one - q));
+
+    if (newGain != g)
+    {
+        g       = newGain;
+        a       = Functions::exp(g * nepersPerDecibel);
+    }
+
+    sqrtA = ((std::sqrt(a) * two) * alpha);
+
+    setCoefficients(calculateCoefficients(filterTypeParamValue, omega, cos, sin, alpha, a, sqrtA));
+}
+
 template <typename SampleType>
 void Biquads<SampleType>::setFilterType(filterType newFilterType)
 {
     if (filterTypeParamValue != newFilterType)
     {
-        filterTypeParamValue = newFilterType;
+        beginTypeCrossfade();
 
-        reset(zero);
+        filterTypeParamValue = newFilterType;
         update(); // calculateCoefficients();
     }
 }
@@ -109,26 +160,263 @@ void Biquads<SampleType>::setTransformType(transformationType newTransformationT
 {
     if (transformationParamValue != newTransformationType)
     {
+        // Carry the state across so the new topology continues the output
+        // of the old one, rather than starting again from silence.
+        for (std::size_t channel = 0; channel < Xn_1.size(); ++channel)
+            convertState(channel, transformationParamValue, newTransformationType);
+
         transformationParamValue = newTransformationType;
-        reset(zero);
         update(); // calculateCoefficients();
     }
 }
 
+template <typename SampleType>
+void Biquads<SampleType>::convertState(std::size_t channel, transformationType from, transformationType to) noexcept
+{
+    using tf = transformationType;
+
+    // Every form is the same transfer function, so all that the future output
+    // depends on is what the state adds to the next two samples. Those two
+    // sums are exactly the state of the DF-II-T, which the conversion goes
+    // through: s1 is added to the next output and s2 to the one after.
+    const double cb0 = b0, cb1 = b1, cb2 = b2, ca1 = a1, ca2 = a2;
+
+    // DF-II, and the poles of the DF-I-T, keep w[n] = x[n] + a1.w[n-1] +
+    // a2.w[n-2]; these are the sums those two past values of w add.
+    const double c1 = (cb0 * ca1) + cb1, c2 = (cb0 * ca2) + cb2, d = (cb1 * ca2) - (ca1 * cb2);
+
+    double s1 = 0.0, s2 = 0.0;
+
+    switch (from)
+    {
+    case tf::directFormI:
+        s1 = (cb1 * Xn_1[channel]) + (cb2 * Xn_2[channel]) + (ca1 * Yn_1[channel]) + (ca2 * Yn_2[channel]);
+        s2 = (cb2 * Xn_1[channel]) + (ca2 * Yn_1[channel]);
+        break;
+    case tf::directFormII:
+        s1 = (c1 * Wn_1[channel]) + (c2 * Wn_2[channel]);
+        s2 = (c2 * Wn_1[channel]) + (d  * Wn_2[channel]);
+        break;
+    case tf::directFormItransposed:
+        s1 = (cb0 * Wn_2[channel]) + Xn_2[channel];
+        s2 = (cb0 * Wn_1[channel]) + Xn_1[channel] + (cb1 * Wn_2[channel]) - (ca1 * Xn_2[channel]);
+        break;
+    case tf::directFormIItransposed:
+    default:
+        s1 = Xn_2[channel];
+        s2 = Xn_1[channel];
+        break;
+    }
+
+    for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
+        (*v)[channel] = zero;
+
+    // Solves the rows of ```m``` for the smallest state that gives (s1, s2).
+    const auto leastNorm = [&](const double (&m)[2][4], double (&out)[4])
+    {
+        const double g11 = (m[0][0] * m[0][0]) + (m[0][1] * m[0][1]) + (m[0][2] * m[0][2]) + (m[0][3] * m[0][3]);
+        const double g12 = (m[0][0] * m[1][0]) + (m[0][1] * m[1][1]) + (m[0][2] * m[1][2]) + (m[0][3] * m[1][3]);
+        const double g22 = (m[1][0] * m[1][0]) + (m[1][1] * m[1][1]) + (m[1][2] * m[1][2]) + (m[1][3] * m[1][3]);
+        const double det = (g11 * g22) - (g12 * g12);
+
+        double l1 = 0.0, l2 = 0.0;
+
+        if (std::abs(det) > 1.0e-12 * ((g11 * g11) + (g22 * g22)))
+        {
+            l1 = ((g22 * s1) - (g12 * s2)) / det;
+            l2 = ((g11 * s2) - (g12 * s1)) / det;
+        }
+        else if (g11 > 0.0)
+        {
+            l1 = s1 / g11;
+        }
+        else if (g22 > 0.0)
+        {
+            l2 = s2 / g22;
+        }
+
+        for (int i = 0; i < 4; ++i)
+            out[i] = (m[0][i] * l1) + (m[1][i] * l2);
+    };
+
+    // The two past values of w that give (s1, s2). The pair has no exact
+    // solution when a zero cancels a pole (as in the first-order types, whose
+    // second delay is unused), and then the smallest will do.
+    const auto solveForW = [&](double& w1, double& w2)
+    {
+        const double det = (c1 * d) - (c2 * c2);
+        const double scale = (c1 * c1) + (2.0 * c2 * c2) + (d * d);
+
+        if (std::abs(det) > 1.0e-9 * scale)
+        {
+            w1 = ((d  * s1) - (c2 * s2)) / det;
+            w2 = ((c1 * s2) - (c2 * s1)) / det;
+            return;
+        }
+
+        const double m[2][4] = { { c1, c2, 0.0, 0.0 }, { c2, d, 0.0, 0.0 } };
+        double w[4];
+        leastNorm(m, w);
+        w1 = w[0], w2 = w[1];
+    };
+
+    double w1 = 0.0, w2 = 0.0;
+
+    switch (to)
+    {
+    case tf::directFormI:
+    {
+        // Any past input and output that sum to (s1, s2) will do; the
+        // smallest is the one least affected by rounding.
+        const double m[2][4] = { { cb1, cb2, ca1, ca2 }, { cb2, 0.0, ca2, 0.0 } };
+        double xy[4];
+        leastNorm(m, xy);
+        Xn_1[channel] = static_cast<SampleType>(xy[0]);
+        Xn_2[channel] = static_cast<SampleType>(xy[1]);
+        Yn_1[channel] = static_cast<SampleType>(xy[2]);
+        Yn_2[channel] = static_cast<SampleType>(xy[3]);
+        break;
+    }
+    case tf::directFormII:
+    {
+        solveForW(w1, w2);
+        Wn_1[channel] = static_cast<SampleType>(w1);
+        Wn_2[channel] = static_cast<SampleType>(w2);
+        break;
+    }
+    case tf::directFormItransposed:
+    {
+        // The poles and the zeros each hold their own copy of the past w, so
+        // the state is the one they would have reached from the same w.
+        solveForW(w1, w2);
+        Wn_2[channel] = static_cast<SampleType>((ca1 * w1) + (ca2 * w2));
+        Wn_1[channel] = static_cast<SampleType>( ca2 * w1);
+        Xn_2[channel] = static_cast<SampleType>((cb1 * w1) + (cb2 * w2));
+        Xn_1[channel] = static_cast<SampleType>( cb2 * w1);
+        break;
+    }
+    case tf::directFormIItransposed:
+    default:
+        Xn_2[channel] = static_cast<SampleType>(s1);
+        Xn_1[channel] = static_cast<SampleType>(s2);
+        break;
+    }
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::setDesignMethod(designMethodType newDesignMethod)
+{
+    if (designMethod != newDesignMethod)
+    {
+        designMethod = newDesignMethod;
+        update(); // calculateCoefficients();
+    }
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::setParameters(filterType newFilterType, SampleType newFrequency, SampleType newResonance, SampleType newGain)
+{
+    jassert(minFrequency <= newFrequency && newFrequency <= maxFrequency);
+    jassert(zero <= newResonance && newResonance <= one);
+
+    hz = juce::jlimit(minFrequency, maxFrequency, newFrequency);
+    q = juce::jlimit(zero, one, newResonance);
+    g = newGain;
+
+    if (filterTypeParamValue != newFilterType)
+    {
+        beginTypeCrossfade();
+        filterTypeParamValue = newFilterType;
+    }
+
+    update(); // calculateCoefficients();
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::setCoefficientCache(BiquadsCoefficientCache<SampleType>* newCache) noexcept
+{
+    coefficientCache = newCache;
+}
+
+template <typename SampleType>
+std::size_t Biquads<SampleType>::getArenaSize(const juce::dsp::ProcessSpec& spec) const noexcept
+{
+    const auto stateSize = StoneyDSP::Core::Arena::getSizeFor<SampleType>(numStateVariables * spec.numChannels);
+
+    // The old filter of a type crossfade needs the same again.
+    return typeCrossfadeTime > 0.0 ? stateSize * 2 : stateSize;
+}
+
+template <typename SampleType>
+int Biquads<SampleType>::getNumAllocations() const noexcept
+{
+    return ownArena.getNumAllocations() + (outgoing != nullptr ? 1 + outgoing->getNumAllocations() : 0);
+}
+
 template <typename SampleType>
 void Biquads<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
 {
-    jassert(spec.sampleRate > 0);
     jassert(spec.numChannels > 0);
 
-    sampleRate = spec.sampleRate;
+    // Preparing again for the same channels (e.g. at a new sample rate) keeps
+    // the state where it is, wherever it was carved from, so only the first
+    // call, or one for a new channel count, allocates.
+    if (Wn_1.size() != spec.numChannels || (typeCrossfadeTime > 0.0 && outgoing == nullptr))
+    {
+        ownArena.prepare(getArenaSize(spec));
+        prepare(spec, ownArena);
+        return;
+    }
+
+    if (outgoing != nullptr)
+        outgoing->prepare(spec);
+
+    prepareSettings(spec);
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::prepare(juce::dsp::ProcessSpec& spec, StoneyDSP::Core::Arena& arena)
+{
+    jassert(spec.numChannels > 0);
+
+    const std::size_t numChannels = spec.numChannels;
+    auto* state = arena.allocate<SampleType>(numStateVariables * numChannels);
+
+    // The arena was prepared without room for this filter; see getArenaSize().
+    if (state == nullptr)
+    {
+        jassertfalse;
+        ownArena.prepare(getArenaSize(spec));
+        state = ownArena.allocate<SampleType>(numStateVariables * numChannels);
+    }
+
+    // All six state variables of every channel, side by side.
+    Wn_1 = { state,                     numChannels };
+    Wn_2 = { state + (numChannels * 1), numChannels };
+    Xn_1 = { state + (numChannels * 2), numChannels };
+    Xn_2 = { state + (numChannels * 3), numChannels };
+    Yn_1 = { state + (numChannels * 4), numChannels };
+    Yn_2 = { state + (numChannels * 5), numChannels };
+
+    // The old filter of a type crossfade runs at the same rate, with the
+    // same channels; it never fades itself.
+    if (typeCrossfadeTime > 0.0)
+    {
+        if (outgoing == nullptr)
+            outgoing = std::make_unique<Biquads>();
+
+        outgoing->prepare(spec, arena);
+    }
+
+    prepareSettings(spec);
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::prepareSettings(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.sampleRate > 0);
 
-    Wn_1.resize(spec.numChannels);
-    Wn_2.resize(spec.numChannels);
-    Xn_1.resize(spec.numChannels);
-    Xn_2.resize(spec.numChannels);
-    Yn_1.resize(spec.numChannels);
-    Yn_2.resize(spec.numChannels);
+    sampleRate = spec.sampleRate;
 
     minFrequency = static_cast <SampleType> (sampleRate / 24576.0);
     maxFrequency = static_cast <SampleType> (sampleRate / 2.125);
@@ -136,6 +424,8 @@ void Biquads<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
     jassert(static_cast <SampleType> (20.0) >= minFrequency && minFrequency <= static_cast <SampleType> (20000.0));
     jassert(static_cast <SampleType> (20.0) <= maxFrequency && maxFrequency >= static_cast <SampleType> (20000.0));
 
+    typeCrossfadeLength = outgoing != nullptr ? static_cast<int>(sampleRate * typeCrossfadeTime) : 0;
+
     reset(zero);
 
     setFrequency(hz);
@@ -154,6 +444,8 @@ void Biquads<SampleType>::reset()
 
     for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
         std::fill(v->begin(), v->end(), initialValue);
+
+    fadeSamplesRemaining = 0;
 }
 
 template <typename SampleType>
@@ -161,6 +453,8 @@ void Biquads<SampleType>::reset(SampleType initialValue)
 {
     for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
         std::fill(v->begin(), v->end(), initialValue);
+
+    fadeSamplesRemaining = 0;
 }
 
 template <typename SampleType>
@@ -173,6 +467,9 @@ SampleType Biquads<SampleType>::processSample(int channel, SampleType inputValue
     jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
     jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
 
+    // The old filter of a type crossfade sees the same input.
+    const auto outgoingValue = fadeSamplesRemaining > 0 ? outgoing->processSample(channel, inputValue) : zero;
+
     switch (transformationParamValue)
     {
     case StoneyDSP::Audio::BiquadsBiLinearTransformationType::directFormI:
@@ -191,6 +488,9 @@ SampleType Biquads<SampleType>::processSample(int channel, SampleType inputValue
         inputValue = directFormIITransposed(channel, inputValue);
     }
 
+    if (fadeSamplesRemaining > 0)
+        inputValue = outgoingValue + ((inputValue - outgoingValue) * fadeGain);
+
     return inputValue;
 }
 
@@ -270,14 +570,268 @@ SampleType Biquads<SampleType>::directFormIITransposed(int channel, SampleType i
     return Yn;
 }
 
+template <typename SampleType>
+void Biquads<SampleType>::processStereoPair(const SampleType* firstInput, const SampleType* secondInput, SampleType* firstOutput, SampleType* secondOutput, std::size_t numSamples, int flags) noexcept
+{
+    jassert(Xn_1.size() >= 2);
+
+    const bool filterFirst  = (flags & filterFirstChannel)  != 0;
+    const bool filterSecond = (flags & filterSecondChannel) != 0;
+    const bool encode       = (flags & encodeMidSide)       != 0;
+    const bool decode       = (flags & decodeMidSide)       != 0;
+
+    const auto half = static_cast<SampleType>(0.5);
+
+    for (std::size_t i = 0; i < numSamples; ++i)
+    {
+        if (rampSamplesRemaining > 0)
+            advanceRamp();
+
+        if (fadeSamplesRemaining > 0)
+            advanceFade();
+
+        auto first  = firstInput[i];
+        auto second = secondInput[i];
+
+        if (encode)
+        {
+            const auto mid  = (first + second) * half;
+            const auto side = (first - second) * half;
+            first = mid, second = side;
+        }
+
+        if (filterFirst)
+            first = processSample(0, first);
+
+        if (filterSecond)
+            second = processSample(1, second);
+
+        if (decode)
+        {
+            const auto left  = first + second;
+            const auto right = first - second;
+            first = left, second = right;
+        }
+
+        firstOutput[i]  = first;
+        secondOutput[i] = second;
+    }
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::processLaneGroup(const SampleType* const* inputs, SampleType* const* outputs, std::size_t firstChannel, std::size_t startSample, std::size_t numSamples) noexcept
+{
+    constexpr auto lanes = laneGroupSize;
+
+    jassert(firstChannel + lanes <= Xn_1.size());
+
+    const SampleType cb0 = b0, cb1 = b1, cb2 = b2, ca1 = a1, ca2 = a2;
+
+    // The same arithmetic as the per-channel kernels above, with the state of
+    // each channel in the group copied into one lane of a local array.
+    SampleType w1[lanes], w2[lanes], x1[lanes], x2[lanes], y1[lanes], y2[lanes];
+    SampleType xn[lanes], yn[lanes], wn[lanes];
+
+    for (std::size_t lane = 0; lane < lanes; ++lane)
+    {
+        w1[lane] = Wn_1[firstChannel + lane];
+        w2[lane] = Wn_2[firstChannel + lane];
+        x1[lane] = Xn_1[firstChannel + lane];
+        x2[lane] = Xn_2[firstChannel + lane];
+        y1[lane] = Yn_1[firstChannel + lane];
+        y2[lane] = Yn_2[firstChannel + lane];
+    }
+
+    const auto run = [&](auto&& step)
+    {
+        for (std::size_t i = startSample; i < numSamples; ++i)
+        {
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                xn[lane] = inputs[lane][i];
+
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                step(lane);
+
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                outputs[lane][i] = yn[lane];
+        }
+    };
+
+    switch (transformationParamValue)
+    {
+    case StoneyDSP::Audio::BiquadsBiLinearTransformationType::directFormI:
+        run([&](std::size_t lane)
+        {
+            yn[lane] = ((xn[lane] * cb0) + (x1[lane] * cb1) + (x2[lane] * cb2) + (y1[lane] * ca1) + (y2[lane] * ca2));
+            x2[lane] = x1[lane], y2[lane] = y1[lane];
+            x1[lane] = xn[lane], y1[lane] = yn[lane];
+        });
+        break;
+    case StoneyDSP::Audio::BiquadsBiLinearTransformationType::directFormII:
+        run([&](std::size_t lane)
+        {
+            wn[lane] = ( xn[lane] + ((w1[lane] * ca1) + (w2[lane] * ca2)));
+            yn[lane] = ((wn[lane] * cb0) + (w1[lane] * cb1) + (w2[lane] * cb2));
+            w2[lane] = w1[lane];
+            w1[lane] = wn[lane];
+        });
+        break;
+    case StoneyDSP::Audio::BiquadsBiLinearTransformationType::directFormItransposed:
+        run([&](std::size_t lane)
+        {
+            wn[lane] = ( xn[lane] + w2[lane]);
+            yn[lane] = ((wn[lane] * cb0) + x2[lane]);
+            x2[lane] = ((wn[lane] * cb1) + x1[lane]), w2[lane] = ((wn[lane] * ca1) + w1[lane]);
+            x1[lane] = ( wn[lane] * cb2),             w1[lane] = ( wn[lane] * ca2);
+        });
+        break;
+    case StoneyDSP::Audio::BiquadsBiLinearTransformationType::directFormIItransposed:
+    default:
+        run([&](std::size_t lane)
+        {
+            yn[lane] = ((xn[lane] * cb0) + (x2[lane]));
+            x2[lane] = ((xn[lane] * cb1) + (x1[lane]) + (yn[lane] * ca1));
+            x1[lane] = ((xn[lane] * cb2) +              (yn[lane] * ca2));
+        });
+        break;
+    }
+
+    for (std::size_t lane = 0; lane < lanes; ++lane)
+    {
+        Wn_1[firstChannel + lane] = w1[lane];
+        Wn_2[firstChannel + lane] = w2[lane];
+        Xn_1[firstChannel + lane] = x1[lane];
+        Xn_2[firstChannel + lane] = x2[lane];
+        Yn_1[firstChannel + lane] = y1[lane];
+        Yn_2[firstChannel + lane] = y2[lane];
+    }
+}
+
 template <typename SampleType>
 void Biquads<SampleType>::calculateCoefficients()
 {
-    alpha = (sin * (one - q));
-    a = (std::pow(SampleType(10), (g * SampleType(0.05))));
-    sqrtA = ((std::sqrt(a) * two) * alpha);
+    // Nothing to design until prepare() has supplied a sample rate.
+    if (sampleRate <= 0.0)
+        return;
+
+    if (designMethod == designMethodType::matched)
+    {
+        designTermsAreValid = false;
+        setCoefficients(calculateMatchedCoefficients(filterTypeParamValue, hz, q, g, sampleRate));
+        return;
+    }
 
-    switch (filterTypeParamValue)
+    if (coefficientCache != nullptr)
+    {
+        designTermsAreValid = false;
+        setCoefficients(coefficientCache->getCoefficients(filterTypeParamValue, hz, q, g, sampleRate));
+        return;
+    }
+
+    updateDesignTerms();
+    setCoefficients(calculateCoefficients(filterTypeParamValue, omega, cos, sin, alpha, a, sqrtA));
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::updateDesignTerms() noexcept
+{
+    omega   = (hz * ((pi * two) / static_cast <SampleType>(sampleRate)));
+    cos     = (std::cos(omega));
+    sin     = (std::sin(omega));
+    alpha   = (sin * (one - q));
+    a       = (std::pow(SampleType(10), (g * SampleType(0.05))));
+    sqrtA   = ((std::sqrt(a) * two) * alpha);
+
+    designTermsAreValid = true;
+}
+
+template <typename SampleType>
+typename Biquads<SampleType>::coefficientsType Biquads<SampleType>::calculateCoefficients(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate, designMethodType method) noexcept
+{
+    constexpr auto zero         = StoneyDSP::Maths::Constants<SampleType>::zero;
+    constexpr auto one          = StoneyDSP::Maths::Constants<SampleType>::one;
+    constexpr auto two          = StoneyDSP::Maths::Constants<SampleType>::two;
+    constexpr auto pi           = juce::MathConstants<SampleType>::pi;
+
+    jassert(sampleRate > 0.0);
+
+    if (method == designMethodType::matched)
+        return calculateMatchedCoefficients(type, frequency, resonance, gain, sampleRate);
+
+    const auto hz       = juce::jlimit(static_cast<SampleType>(sampleRate / 24576.0), static_cast<SampleType>(sampleRate / 2.125), frequency);
+    const auto q        = juce::jlimit(zero, one, resonance);
+
+    const auto omega    = (hz * ((pi * two) / static_cast <SampleType>(sampleRate)));
+    const auto cos      = (std::cos(omega));
+    const auto sin      = (std::sin(omega));
+    const auto alpha    = (sin * (one - q));
+    const auto a        = (std::pow(SampleType(10), (gain * SampleType(0.05))));
+    const auto sqrtA    = ((std::sqrt(a) * two) * alpha);
+
+    return calculateCoefficients(type, omega, cos, sin, alpha, a, sqrtA);
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::calculateCoefficients(const filterType* types, const SampleType* frequencies, const SampleType* resonances, const SampleType* gains, coefficientsType* coefficients, std::size_t numFilters, double sampleRate) noexcept
+{
+    using Functions = StoneyDSP::Maths::Functions<SampleType>;
+
+    constexpr auto zero         = StoneyDSP::Maths::Constants<SampleType>::zero;
+    constexpr auto one          = StoneyDSP::Maths::Constants<SampleType>::one;
+    constexpr auto two          = StoneyDSP::Maths::Constants<SampleType>::two;
+    constexpr auto pi           = juce::MathConstants<SampleType>::pi;
+
+    // ln(10) / 20, since 10^(gain / 20) == e^(gain * ln(10) / 20)
+    constexpr auto nepersPerDecibel = static_cast<SampleType>(0.11512925464970228420);
+
+    // Filters are designed in chunks, so that the working arrays fit on the
+    // stack (and in L1) whatever the number of filters.
+    constexpr std::size_t chunkSize = 64;
+
+    jassert(sampleRate > 0.0);
+
+    const auto minHz    = static_cast<SampleType>(sampleRate / 24576.0);
+    const auto maxHz    = static_cast<SampleType>(sampleRate / 2.125);
+    const auto radians  = (pi * two) / static_cast<SampleType>(sampleRate);
+
+    SampleType omega[chunkSize], cos[chunkSize], sin[chunkSize], alpha[chunkSize], a[chunkSize], sqrtA[chunkSize];
+
+    for (std::size_t start = 0; start < numFilters; start += chunkSize)
+    {
+        const auto count = std::min(chunkSize, numFilters - start);
+
+        // First pass; the transcendental terms. Straight-line code over plain
+        // arrays, so that the compiler can vectorise it.
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto hz   = std::min(maxHz, std::max(minHz, frequencies[start + i]));
+            const auto q    = std::min(one, std::max(zero, resonances[start + i]));
+
+            omega[i] = hz * radians;
+            Functions::sinCos(omega[i], sin[i], cos[i]);
+            alpha[i] = sin[i] * (one - q);
+            a[i]     = Functions::exp(gains[start + i] * nepersPerDecibel);
+            sqrtA[i] = (std::sqrt(a[i]) * two) * alpha[i];
+        }
+
+        // Second pass; the per-type arithmetic.
+        for (std::size_t i = 0; i < count; ++i)
+            coefficients[start + i] = calculateCoefficients(types[start + i], omega[i], cos[i], sin[i], alpha[i], a[i], sqrtA[i]);
+    }
+}
+
+template <typename SampleType>
+typename Biquads<SampleType>::coefficientsType Biquads<SampleType>::calculateCoefficients(filterType type, SampleType omega, SampleType cos, SampleType sin, SampleType alpha, SampleType a, SampleType sqrtA) noexcept
+{
+    constexpr auto zero         = StoneyDSP::Maths::Constants<SampleType>::zero;
+    constexpr auto one          = StoneyDSP::Maths::Constants<SampleType>::one;
+    constexpr auto two          = StoneyDSP::Maths::Constants<SampleType>::two;
+    constexpr auto minusOne     = StoneyDSP::Maths::Constants<SampleType>::minusOne;
+    constexpr auto minusTwo     = StoneyDSP::Maths::Constants<SampleType>::minusTwo;
+
+    SampleType b_0, b_1, b_2, a_0, a_1, a_2;
+
+    switch (type)
     {
     case filterType::lowPass2:
 
@@ -471,12 +1025,316 @@ void Biquads<SampleType>::calculateCoefficients()
         break;
     }
 
-    a0 = (  one  / a_0);
-    a1 = ((-a_1) * a0);
-    a2 = ((-a_2) * a0);
-    b0 = (  b_0  * a0);
-    b1 = (  b_1  * a0);
-    b2 = (  b_2  * a0);
+    const auto a0 = (  one  / a_0);
+
+    coefficientsType coefficients;
+
+    coefficients.a1 = ((-a_1) * a0);
+    coefficients.a2 = ((-a_2) * a0);
+    coefficients.b0 = (  b_0  * a0);
+    coefficients.b1 = (  b_1  * a0);
+    coefficients.b2 = (  b_2  * a0);
+
+    return coefficients;
+}
+
+template <typename SampleType>
+typename Biquads<SampleType>::coefficientsType Biquads<SampleType>::calculateMatchedCoefficients(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate) noexcept
+{
+    constexpr auto pi = juce::MathConstants<double>::pi;
+
+    jassert(sampleRate > 0.0);
+
+    const auto hz = juce::jlimit(sampleRate / 24576.0, sampleRate / 2.125, static_cast<double>(frequency));
+    const auto q  = juce::jlimit(0.0, 1.0, static_cast<double>(resonance));
+
+    // The bilinear design's alpha is sin(w0) * (1 - q), i.e. 1 / (2Q) is
+    // 1 - q: the damping of the analog prototype. Full resonance would put
+    // the poles on the unit circle and the peak at infinity, so stop short.
+    const auto w0   = (hz * pi * 2.0) / sampleRate;
+    const auto zeta = std::max(1.0 - q, 0.001);
+    const auto a    = std::pow(10.0, static_cast<double>(gain) * 0.05);
+
+    // Where the poles sit, relative to w0, and how damped they are.
+    auto poleScale = 1.0;
+    auto poleZeta = zeta;
+
+    switch (type)
+    {
+    case filterType::lowPass2:
+    case filterType::highPass2:
+    case filterType::bandPass:
+    case filterType::bandPassQ:
+    case filterType::notch:
+    case filterType::allPass:
+        break;
+
+    case filterType::peak:
+        poleZeta = zeta / a;
+        break;
+
+    case filterType::lowShelf2:
+        poleScale = 1.0 / std::sqrt(a);
+        break;
+
+    case filterType::highShelf2:
+        poleScale = std::sqrt(a);
+        break;
+
+    default:
+        // First-order types are designed the same way either way.
+        return calculateCoefficients(type, frequency, resonance, gain, sampleRate, designMethodType::bilinear);
+    }
+
+    // Impulse invariance: the roots of s^2 + 2 zeta w s + w^2, mapped by
+    // z = e^(sT), as 1 + c1 z^-1 + c2 z^-2. A resonance pushed past Nyquist
+    // (a high shelf near the top) is held at Nyquist rather than folded back.
+    const auto mapRoots = [&] (double w, double z, double& c1, double& c2)
+    {
+        const auto radius = std::exp(-z * w);
+
+        c1 = z <= 1.0 ? -2.0 * radius * std::cos(std::min(w * std::sqrt(1.0 - (z * z)), pi))
+                      : -2.0 * radius * std::cosh(w * std::sqrt((z * z) - 1.0));
+        c2 = radius * radius;
+    };
+
+    double d1, d2;
+    mapRoots(w0 * poleScale, poleZeta, d1, d2);
+
+    // |D(e^jw)|^2 = A0 phi0 + A1 phi1 + A2 phi2, with phi1 = sin^2(w / 2),
+    // phi0 = 1 - phi1 and phi2 = 4 phi0 phi1; the same goes for |N|^2 and B.
+    const auto A0 = (1.0 + d1 + d2) * (1.0 + d1 + d2);
+    const auto A1 = (1.0 - d1 + d2) * (1.0 - d1 + d2);
+    const auto A2 = -4.0 * d2;
+
+    const auto halfSin = std::sin(w0 * 0.5);
+    const auto phi1 = halfSin * halfSin;
+    const auto phi0 = 1.0 - phi1;
+    const auto phi2 = 4.0 * phi0 * phi1;
+
+    const auto denominatorAtCentre = (A0 * phi0) + (A1 * phi1) + (A2 * phi2);
+    const auto centre = getAnalogMagnitudeSquared(type, 1.0, zeta, a) * denominatorAtCentre;
+
+    double n0, n1, n2;
+
+    switch (type)
+    {
+    case filterType::highPass2:
+    {
+        // A double zero at DC, as in the analog filter; matched at w0.
+        n0 = std::sqrt(centre) / (4.0 * phi1);
+        n1 = -2.0 * n0;
+        n2 = n0;
+        break;
+    }
+
+    case filterType::notch:
+    {
+        // Zeros exactly on w0; unity gain at DC.
+        n0 = (1.0 + d1 + d2) / (2.0 - (2.0 * std::cos(w0)));
+        n1 = -2.0 * std::cos(w0) * n0;
+        n2 = n0;
+        break;
+    }
+
+    case filterType::allPass:
+    {
+        n0 = d2;
+        n1 = d1;
+        n2 = 1.0;
+        break;
+    }
+
+    case filterType::lowShelf2:
+    case filterType::highShelf2:
+    {
+        // The zeros mirror the poles about w0 and are mapped the same way,
+        // then scaled to the analog gain at DC. Fitting the shelves as below
+        // misses their resonant bumps at higher resonance.
+        double z1, z2;
+        mapRoots(w0 / poleScale, zeta, z1, z2);
+
+        n0 = std::sqrt(getAnalogMagnitudeSquared(type, 0.0, zeta, a)) * (1.0 + d1 + d2) / (1.0 + z1 + z2);
+        n1 = z1 * n0;
+        n2 = z2 * n0;
+        break;
+    }
+
+    default:
+    {
+        // Matched at DC and w0 and, but for the low-pass (which keeps
+        // n2 = 0, so it falls away towards Nyquist), at Nyquist too.
+        const auto B0 = A0 * getAnalogMagnitudeSquared(type, 0.0, zeta, a);
+        const auto B1 = type == filterType::lowPass2 ? (centre - (B0 * phi0)) / phi1
+                                                     : A1 * getAnalogMagnitudeSquared(type, pi / w0, zeta, a);
+        const auto B2 = type == filterType::lowPass2 ? 0.0
+                                                     : (centre - (B0 * phi0) - (B1 * phi1)) / phi2;
+
+        const auto sqrtB0 = std::sqrt(std::max(B0, 0.0));
+        const auto sqrtB1 = std::sqrt(std::max(B1, 0.0));
+        const auto w = 0.5 * (sqrtB0 + sqrtB1);
+
+        n0 = 0.5 * (w + std::sqrt(std::max((w * w) + B2, 0.0)));
+        n1 = 0.5 * (sqrtB0 - sqrtB1);
+        n2 = n0 != 0.0 ? -B2 / (4.0 * n0) : 0.0;
+        break;
+    }
+    }
+
+    coefficientsType coefficients;
+
+    coefficients.b0 = static_cast<SampleType>(n0);
+    coefficients.b1 = static_cast<SampleType>(n1);
+    coefficients.b2 = static_cast<SampleType>(n2);
+    coefficients.a1 = static_cast<SampleType>(-d1);
+    coefficients.a2 = static_cast<SampleType>(-d2);
+
+    return coefficients;
+}
+
+template <typename SampleType>
+double Biquads<SampleType>::getAnalogMagnitudeSquared(filterType type, double x, double zeta, double a) noexcept
+{
+    // The prototypes of the bilinear designs above, with s = jx and
+    // 1 / Q = 2 zeta. The shelves and the peak use 'a' where the RBJ
+    // cookbook uses A.
+    const auto x2 = x * x;
+    const auto damping = (2.0 * zeta * x) * (2.0 * zeta * x);
+    const auto resonant = ((1.0 - x2) * (1.0 - x2)) + damping;
+
+    switch (type)
+    {
+    case filterType::lowPass2:
+        return 1.0 / resonant;
+
+    case filterType::highPass2:
+        return (x2 * x2) / resonant;
+
+    case filterType::bandPass:
+        return x2 / resonant;
+
+    case filterType::bandPassQ:
+        return damping / resonant;
+
+    case filterType::peak:
+        return (((1.0 - x2) * (1.0 - x2)) + (damping * a * a)) / (((1.0 - x2) * (1.0 - x2)) + (damping / (a * a)));
+
+    case filterType::lowShelf2:
+        return (a * a) * (((a - x2) * (a - x2)) + (damping * a)) / (((1.0 - (a * x2)) * (1.0 - (a * x2))) + (damping * a));
+
+    case filterType::highShelf2:
+        return (a * a) * (((1.0 - (a * x2)) * (1.0 - (a * x2))) + (damping * a)) / (((a - x2) * (a - x2)) + (damping * a));
+
+    case filterType::notch:
+        return ((1.0 - x2) * (1.0 - x2)) / resonant;
+
+    default:
+        return 1.0;
+    }
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::setCoefficients(const coefficientsType& newCoefficients, int rampLengthInSamples) noexcept
+{
+    if (rampLengthInSamples <= 0)
+    {
+        b0 = newCoefficients.b0;
+        b1 = newCoefficients.b1;
+        b2 = newCoefficients.b2;
+        a0 = one;
+        a1 = newCoefficients.a1;
+        a2 = newCoefficients.a2;
+
+        rampSamplesRemaining = 0;
+        return;
+    }
+
+    const auto scale = one / static_cast<SampleType>(rampLengthInSamples);
+
+    rampTarget = newCoefficients;
+
+    rampStep.b0 = (newCoefficients.b0 - b0) * scale;
+    rampStep.b1 = (newCoefficients.b1 - b1) * scale;
+    rampStep.b2 = (newCoefficients.b2 - b2) * scale;
+    rampStep.a1 = (newCoefficients.a1 - a1) * scale;
+    rampStep.a2 = (newCoefficients.a2 - a2) * scale;
+
+    rampSamplesRemaining = rampLengthInSamples;
+}
+
+template <typename SampleType>
+typename Biquads<SampleType>::coefficientsType Biquads<SampleType>::getCoefficients() const noexcept
+{
+    coefficientsType coefficients;
+
+    coefficients.b0 = b0;
+    coefficients.b1 = b1;
+    coefficients.b2 = b2;
+    coefficients.a1 = a1;
+    coefficients.a2 = a2;
+
+    return coefficients;
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::advanceRamp() noexcept
+{
+    b0 = b0 + rampStep.b0;
+    b1 = b1 + rampStep.b1;
+    b2 = b2 + rampStep.b2;
+    a1 = a1 + rampStep.a1;
+    a2 = a2 + rampStep.a2;
+
+    // Land exactly on the target, whatever rounding happened on the way.
+    if (--rampSamplesRemaining == 0)
+        setCoefficients(rampTarget);
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::setTypeCrossfadeTime(double newTimeInSeconds) noexcept
+{
+    jassert(newTimeInSeconds >= 0.0);
+
+    typeCrossfadeTime = std::max(0.0, newTimeInSeconds);
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::crossfadeToCoefficients(const coefficientsType& newCoefficients) noexcept
+{
+    beginTypeCrossfade();
+    setCoefficients(newCoefficients);
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::beginTypeCrossfade() noexcept
+{
+    // Without room for a fade, the old state means nothing to the new type.
+    if (outgoing == nullptr || typeCrossfadeLength <= 0)
+    {
+        reset(zero);
+        return;
+    }
+
+    // The new filter carries on from the old state, and the old filter from
+    // an exact copy of it. A change that arrives mid-fade starts again from
+    // the filter that was fading in.
+    outgoing->copyStateFrom(*this);
+
+    fadeSamplesRemaining = typeCrossfadeLength;
+    fadeStep = one / static_cast<SampleType>(typeCrossfadeLength);
+    fadeGain = zero;
+}
+
+template <typename SampleType>
+void Biquads<SampleType>::advanceFade() noexcept
+{
+    if (outgoing->rampSamplesRemaining > 0)
+        outgoing->advanceRamp();
+
+    fadeGain = fadeGain + fadeStep;
+
+    if (--fadeSamplesRemaining == 0)
+        fadeGain = one;
 }
 
 template <typename SampleType>
@@ -493,10 +1351,85 @@ void Biquads<SampleType>::update()
     calculateCoefficients();
 }
 
+template <typename SampleType>
+template <typename OtherSampleType>
+void Biquads<SampleType>::copyStateFrom(const Biquads<OtherSampleType>& other) noexcept
+{
+    jassert(sampleRate == other.sampleRate);
+
+    const auto copyState = [](const StoneyDSP::Core::ArenaArray<OtherSampleType>& source, StoneyDSP::Core::ArenaArray<SampleType>& destination)
+    {
+        jassert(source.size() == destination.size());
+
+        const auto numChannels = std::min(source.size(), destination.size());
+
+        for (std::size_t channel = 0; channel < numChannels; ++channel)
+            destination[channel] = static_cast<SampleType>(source[channel]);
+    };
+
+    copyState(other.Wn_1, Wn_1);
+    copyState(other.Wn_2, Wn_2);
+    copyState(other.Xn_1, Xn_1);
+    copyState(other.Xn_2, Xn_2);
+    copyState(other.Yn_1, Yn_1);
+    copyState(other.Yn_2, Yn_2);
+
+    const auto copyCoefficients = [](const BiquadsCoefficients<OtherSampleType>& source)
+    {
+        coefficientsType coefficients;
+
+        coefficients.b0 = static_cast<SampleType>(source.b0);
+        coefficients.b1 = static_cast<SampleType>(source.b1);
+        coefficients.b2 = static_cast<SampleType>(source.b2);
+        coefficients.a1 = static_cast<SampleType>(source.a1);
+        coefficients.a2 = static_cast<SampleType>(source.a2);
+
+        return coefficients;
+    };
+
+    b0 = static_cast<SampleType>(other.b0.get());
+    b1 = static_cast<SampleType>(other.b1.get());
+    b2 = static_cast<SampleType>(other.b2.get());
+    a0 = static_cast<SampleType>(other.a0.get());
+    a1 = static_cast<SampleType>(other.a1.get());
+    a2 = static_cast<SampleType>(other.a2.get());
+
+    rampTarget = copyCoefficients(other.rampTarget);
+    rampStep = copyCoefficients(other.rampStep);
+    rampSamplesRemaining = other.rampSamplesRemaining;
+
+    hz = static_cast<SampleType>(other.hz);
+    q = static_cast<SampleType>(other.q);
+    g = static_cast<SampleType>(other.g);
+
+    filterTypeParamValue = other.filterTypeParamValue;
+    transformationParamValue = other.transformationParamValue;
+    designMethod = other.designMethod;
+
+    // The next fast re-design starts again from a full one, at this precision.
+    designTermsAreValid = false;
+
+    // A type crossfade carries on, too, if there is room for it here.
+    fadeSamplesRemaining = 0;
+
+    if (other.fadeSamplesRemaining > 0 && other.outgoing != nullptr && outgoing != nullptr)
+    {
+        outgoing->copyStateFrom(*other.outgoing);
+        fadeSamplesRemaining = other.fadeSamplesRemaining;
+        fadeGain = static_cast<SampleType>(other.fadeGain);
+        fadeStep = static_cast<SampleType>(other.fadeStep);
+    }
+}
+
 //==============================================================================
 template class Biquads<float>;
 template class Biquads<double>;
 
+template void Biquads<float>::copyStateFrom<float>(const Biquads<float>&) noexcept;
+template void Biquads<float>::copyStateFrom<double>(const Biquads<double>&) noexcept;
+template void Biquads<double>::copyStateFrom<float>(const Biquads<float>&) noexcept;
+template void Biquads<double>::copyStateFrom<double>(const Biquads<double>&) noexcept;
+
   /// @} group StoneyDSP::Audio
 } // namespace Audio
 
@@ -63,6 +63,56 @@ enum struct BiquadsBiLinearTransformationType
     directFormIItransposed = 3
 };
 
+/**
+ * @brief How the second-order types are designed from their analog
+ * prototypes. ```bilinear``` is the bilinear transform, which squeezes the
+ * whole analog response below Nyquist and so cramps it near the top.
+ * ```matched``` takes the poles straight from the analog ones (impulse
+ * invariance) and fits the zeros to the analog magnitude at DC, at the
+ * centre frequency and at Nyquist, after Vicanek's "Matched Second Order
+ * Digital Filters", which follows the analog response up to Nyquist without
+ * oversampling. The shelves take their zeros from the analog ones, as with
+ * the poles. First-order types are the same either way.
+ */
+enum struct BiquadsDesignMethod
+{
+    bilinear = 0,
+    matched = 1
+};
+
+/**
+ * @brief Flags for ```Biquads::processStereo()```, to be or'ed together:
+ * which channels of a stereo pair to filter, and whether to matrix the pair
+ * to mid/side on the way in and back to left/right on the way out.
+ */
+enum BiquadsStereoFlags
+{
+    filterFirstChannel  = 1,
+    filterSecondChannel = 2,
+    filterBothChannels  = 3,
+    encodeMidSide       = 4,
+    decodeMidSide       = 8
+};
+
+/**
+ * @brief A normalised set of Biquad coefficients, i.e. ```a0``` is always one
+ * and the feedback coefficients are stored negated, ready to be summed.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+struct BiquadsCoefficients
+{
+    SampleType b0 = static_cast<SampleType>(1.0);
+    SampleType b1 = static_cast<SampleType>(0.0);
+    SampleType b2 = static_cast<SampleType>(0.0);
+    SampleType a1 = static_cast<SampleType>(0.0);
+    SampleType a2 = static_cast<SampleType>(0.0);
+};
+
+template <typename SampleType>
+class BiquadsCoefficientCache;
+
 /**
  * @brief The 'Biquads' class.
  *
@@ -74,6 +124,8 @@ class Biquads
 public:
     using filterType            = StoneyDSP::Audio::BiquadsFilterType;
     using transformationType    = StoneyDSP::Audio::BiquadsBiLinearTransformationType;
+    using designMethodType      = StoneyDSP::Audio::BiquadsDesignMethod;
+    using coefficientsType      = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
     //==============================================================================
     /** Constructor. */
     Biquads();
@@ -95,19 +147,158 @@ public:
      */
     void setGain(SampleType newGain);
     /**
-     * @brief Sets the type of the filter.
+     * @brief Sets the gain of the filter, recomputing only the gain-dependent
+     * terms of the design; the trigonometry from the last full design is
+     * reused. Cheap enough to call at control rate, e.g. for dynamic EQ.
+     * @param newGain the new gain amount in Decibels.
+     */
+    void setGainFast(SampleType newGain) noexcept;
+    /**
+     * @brief Sets the frequency, resonance and gain of the filter together,
+     * for modulation at control rate. Only the terms whose input has changed
+     * are recomputed, with the polynomial approximations from
+     * ```StoneyDSP::Maths::Functions``` in place of ```std::sin```,
+     * ```std::cos``` and ```std::pow```; the type is that of the last full
+     * design. Does not allocate.
+     *
+     * @param newFrequencyHz the new cutoff frequency in Hz.
+     * @param newResonance the new resonance amount from 0 (min) to 1 (max).
+     * @param newGain the new gain amount in Decibels.
+     */
+    void setParametersFast(SampleType newFrequencyHz, SampleType newResonance, SampleType newGain) noexcept;
+    /**
+     * @brief Sets the type of the filter. With a type crossfade time (see
+     * ```setTypeCrossfadeTime()```), the old filter keeps running alongside
+     * the new one while the output fades across; otherwise the state is
+     * reset.
      * @param newFilterType the new filter type.
      */
     void setFilterType(filterType newFilterType);
     /**
-     * @brief Sets the BiLinear Transform type of the filter.
+     * @brief Sets the BiLinear Transform type of the filter. The state is
+     * carried over into the new topology, so the output continues without a
+     * click.
      * @param newTransformType the new transformation type.
      */
     void setTransformType(transformationType newTransformType);
+    /**
+     * @brief Sets how the second-order types are designed. The filter state
+     * is kept.
+     * @param newDesignMethod the new design method.
+     */
+    void setDesignMethod(designMethodType newDesignMethod);
+    /** Returns the current design method. */
+    designMethodType getDesignMethod() const noexcept { return designMethod; }
+    /**
+     * @brief Sets the type, frequency, resonance and gain together, designing
+     * the coefficients only once (the individual setters design once each).
+     *
+     * @param newFilterType the new filter type.
+     * @param newFrequencyHz the new cutoff frequency in Hz.
+     * @param newResonance the new resonance amount from 0 (min) to 1 (max).
+     * @param newGain the new gain amount in Decibels.
+     */
+    void setParameters(filterType newFilterType, SampleType newFrequencyHz, SampleType newResonance, SampleType newGain);
+    /**
+     * @brief Makes this filter take its coefficients from a shared cache
+     * (see ```BiquadsCoefficientCache::getInstance()```) instead of designing
+     * them itself. Pass ```nullptr``` to design them here again.
+     *
+     * @param newCache the cache to use, which must outlive this filter.
+     */
+    void setCoefficientCache(BiquadsCoefficientCache<SampleType>* newCache) noexcept;
+    /**
+     * @brief Replaces the current coefficients with a set designed elsewhere
+     * (see ```calculateCoefficients()```), gliding linearly from the current
+     * set over the given number of samples. The frequency, resonance, gain and
+     * type held by this filter are not changed.
+     *
+     * @param newCoefficients the new coefficients.
+     * @param rampLengthInSamples the length of the glide; zero is immediate.
+     */
+    void setCoefficients(const coefficientsType& newCoefficients, int rampLengthInSamples = 0) noexcept;
+    /** Returns the coefficients that are currently in use. */
+    coefficientsType getCoefficients() const noexcept;
+    /**
+     * @brief Sets how long a change of filter type takes to fade in, during
+     * which the old filter runs alongside the new one. Zero (the default)
+     * resets the state on a change of type instead. Takes effect at the next
+     * ```prepare()```, which allocates what the fade needs.
+     *
+     * @param newTimeInSeconds the length of the crossfade, in seconds.
+     */
+    void setTypeCrossfadeTime(double newTimeInSeconds) noexcept;
+    /**
+     * @brief Replaces the current coefficients with a set designed elsewhere
+     * for a different filter type, crossfading from the old filter as
+     * ```setFilterType()``` does. Does not allocate.
+     *
+     * @param newCoefficients the new coefficients.
+     */
+    void crossfadeToCoefficients(const coefficientsType& newCoefficients) noexcept;
+    /** Returns true while a change of type is fading in. */
+    bool isCrossfading() const noexcept { return fadeSamplesRemaining > 0; }
+    /** Returns true while gliding to new coefficients, or fading between types. */
+    bool isGliding() const noexcept { return rampSamplesRemaining > 0 || fadeSamplesRemaining > 0; }
+    /** Returns the current filter type. */
+    filterType getFilterType() const noexcept { return filterTypeParamValue; }
+
+    //==============================================================================
+    /**
+     * @brief Designs a set of coefficients without touching any filter state.
+     * This is thread-safe and can be called from any thread.
+     *
+     * @param type the filter type.
+     * @param frequency the cutoff frequency in Hz.
+     * @param resonance the resonance from 0 (min) to 1 (max).
+     * @param gain the gain in Decibels.
+     * @param sampleRate the sample rate that the filter runs at.
+     * @param method how to design the second-order types.
+     */
+    static coefficientsType calculateCoefficients(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate, designMethodType method = designMethodType::bilinear) noexcept;
+    /**
+     * @brief Designs many sets of coefficients in one go, from
+     * structure-of-arrays settings. The trigonometry and the gain are worked
+     * out with polynomial approximations (see ```StoneyDSP::Maths::Functions```)
+     * in a separate pass that the compiler can vectorise, so results may
+     * differ from the single-filter version in the last few bits. This is
+     * thread-safe, does not allocate, and can be called from any thread.
+     *
+     * @param types the filter type of each filter.
+     * @param frequencies the cutoff frequency of each filter, in Hz.
+     * @param resonances the resonance of each filter, from 0 (min) to 1 (max).
+     * @param gains the gain of each filter, in Decibels.
+     * @param coefficients receives the coefficients of each filter.
+     * @param numFilters the number of filters, i.e. the length of each array.
+     * @param sampleRate the sample rate that the filters run at.
+     */
+    static void calculateCoefficients(const filterType* types, const SampleType* frequencies, const SampleType* resonances, const SampleType* gains, coefficientsType* coefficients, std::size_t numFilters, double sampleRate) noexcept;
 
     //==============================================================================
-    /** Initialises the processor. */
+    /**
+     * @brief Initialises the processor. The state is kept in an arena of the
+     * filter's own, which is only allocated the first time, or when the
+     * channel count changes.
+     */
     void prepare(juce::dsp::ProcessSpec& spec);
+    /**
+     * @brief Initialises the processor, with its state carved from a shared
+     * arena that was prepared with room for at least ```getArenaSize()```.
+     * Does not allocate, except for the old filter of a type crossfade (see
+     * ```setTypeCrossfadeTime()```) the first time round. Preparing again
+     * with ```prepare(spec)``` for the same channel count keeps the state
+     * in the shared arena.
+     */
+    void prepare(juce::dsp::ProcessSpec& spec, StoneyDSP::Core::Arena& arena);
+    /** Returns the room that ```prepare()``` takes from an arena, in bytes. */
+    std::size_t getArenaSize(const juce::dsp::ProcessSpec& spec) const noexcept;
+    /**
+     * @brief Returns the number of times the processor has gone to the heap:
+     * its own arena, and the old filter of a type crossfade with its own.
+     * Like ```StoneyDSP::Core::Arena::getNumAllocations()```, a count that
+     * has not changed since preparing proves that nothing was allocated.
+     */
+    int getNumAllocations() const noexcept;
 
     /** Resets the internal state variables of the processor. */
     void reset();
@@ -126,10 +317,39 @@ public:
      */
     void snapToZero() noexcept;
 
+    /**
+     * @brief Takes over the state, coefficients, glide and settings of a
+     * filter of the other precision, so that it carries on from where that
+     * one left off. Both must be prepared for the same sample rate and
+     * channel count; nothing is allocated.
+     */
+    template <typename OtherSampleType>
+    void copyStateFrom(const Biquads<OtherSampleType>& other) noexcept;
+
     //==============================================================================
+    /**
+     * @brief The number of channels that ```process()``` filters together,
+     * one per SIMD lane, once a block has at least that many. Any channels
+     * left over are filtered one at a time.
+     */
+    static constexpr std::size_t laneGroupSize = 4;
+
     /** Processes the input and output samples supplied in the processing context. */
     template <typename ProcessContext>
     void process (const ProcessContext& context) noexcept
+    {
+        processChannels (context, 0);
+    }
+
+    /**
+     * @brief Processes a context that holds only some of the filter's
+     * channels, from ```firstChannel``` on, as ```process()``` does. A filter
+     * that isn't gliding (see ```isGliding()```) shares nothing between its
+     * channels, so different channels of it can be run on different threads
+     * at once.
+     */
+    template <typename ProcessContext>
+    void processChannels (const ProcessContext& context, size_t firstChannel) noexcept
     {
         const auto& inputBlock = context.getInputBlock();
         auto& outputBlock      = context.getOutputBlock();
@@ -145,16 +365,128 @@ public:
             return;
         }
 
-        for (size_t channel = 0; channel < numChannels; ++channel)
+        size_t startSample = 0;
+
+        // While gliding between two coefficient sets, or fading from one
+        // filter type to another, every channel must see the same
+        // coefficients and gain for the same sample, so run sample-by-sample.
+        while ((rampSamplesRemaining > 0 || fadeSamplesRemaining > 0) && startSample < numSamples)
+        {
+            if (rampSamplesRemaining > 0)
+                advanceRamp();
+
+            if (fadeSamplesRemaining > 0)
+                advanceFade();
+
+            for (size_t channel = 0; channel < numChannels; ++channel)
+            {
+                auto* outputSamples = outputBlock.getChannelPointer (channel);
+                outputSamples[startSample] = processSample ((int) (firstChannel + channel), inputBlock.getChannelPointer (channel)[startSample]);
+            }
+
+            ++startSample;
+        }
+
+        size_t channel = 0;
+
+        // Wide layouts (surround, ambisonics) run a group of channels at a
+        // time, one per SIMD lane, all sharing the same coefficients.
+        for (; channel + laneGroupSize <= numChannels; channel += laneGroupSize)
+        {
+            const SampleType* inputs[laneGroupSize];
+            SampleType* outputs[laneGroupSize];
+
+            for (size_t lane = 0; lane < laneGroupSize; ++lane)
+            {
+                inputs[lane]  = inputBlock .getChannelPointer (channel + lane);
+                outputs[lane] = outputBlock.getChannelPointer (channel + lane);
+            }
+
+            processLaneGroup (inputs, outputs, firstChannel + channel, startSample, numSamples);
+        }
+
+        for (; channel < numChannels; ++channel)
         {
             auto* inputSamples  = inputBlock .getChannelPointer (channel);
             auto* outputSamples = outputBlock.getChannelPointer (channel);
 
-            for (size_t i = 0; i < numSamples; ++i)
-                outputSamples[i] = processSample ((int) channel, inputSamples[i]);
+            for (size_t i = startSample; i < numSamples; ++i)
+                outputSamples[i] = processSample ((int) (firstChannel + channel), inputSamples[i]);
         }
     }
 
+    /**
+     * @brief Processes the context with a new set of coefficients for every
+     * sample, e.g. from ```BiquadsCoefficientTable::getLinear()```, for
+     * audio-rate modulation. Any glide in progress is dropped, and the last
+     * set stays in use afterwards.
+     *
+     * @param context the processing context.
+     * @param coefficientsPerSample one set of coefficients per sample.
+     */
+    template <typename ProcessContext>
+    void process (const ProcessContext& context, const coefficientsType* coefficientsPerSample) noexcept
+    {
+        const auto& inputBlock = context.getInputBlock();
+        auto& outputBlock      = context.getOutputBlock();
+        const auto numChannels = outputBlock.getNumChannels();
+        const auto numSamples  = outputBlock.getNumSamples();
+
+        jassert (inputBlock.getNumChannels() == numChannels);
+        jassert (inputBlock.getNumSamples()  == numSamples);
+        jassert (coefficientsPerSample != nullptr);
+
+        if (context.isBypassed)
+        {
+            outputBlock.copyFrom (inputBlock);
+            return;
+        }
+
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            setCoefficients (coefficientsPerSample[i]);
+
+            if (fadeSamplesRemaining > 0)
+                advanceFade();
+
+            for (size_t channel = 0; channel < numChannels; ++channel)
+            {
+                auto* outputSamples = outputBlock.getChannelPointer (channel);
+                outputSamples[i] = processSample ((int) channel, inputBlock.getChannelPointer (channel)[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Processes a stereo pair, filtering either or both channels in a
+     * single pass. A chain of bands in mid/side passes ```encodeMidSide```
+     * to its first band and ```decodeMidSide``` to its last, so the matrix
+     * costs no extra pass over the buffer; the pair is encoded as
+     * M = (L + R) / 2, S = (L - R) / 2 and decoded as L = M + S, R = M - S.
+     *
+     * @param context the processing context, with exactly two channels.
+     * @param flags any combination of ```BiquadsStereoFlags```.
+     */
+    template <typename ProcessContext>
+    void processStereo (const ProcessContext& context, int flags) noexcept
+    {
+        const auto& inputBlock = context.getInputBlock();
+        auto& outputBlock      = context.getOutputBlock();
+
+        jassert (inputBlock.getNumChannels() == 2 && outputBlock.getNumChannels() == 2);
+        jassert (inputBlock.getNumSamples()  == outputBlock.getNumSamples());
+
+        if (context.isBypassed)
+        {
+            outputBlock.copyFrom (inputBlock);
+            return;
+        }
+
+        processStereoPair (inputBlock .getChannelPointer (0), inputBlock .getChannelPointer (1),
+                           outputBlock.getChannelPointer (0), outputBlock.getChannelPointer (1),
+                           outputBlock.getNumSamples(), flags);
+    }
+
     /** Performs the processing operation on a single sample at a time. */
     SampleType processSample (int channel, SampleType inputValue);
 
@@ -163,25 +495,87 @@ private:
     /** Updates the internal state variables of the processor. */
     void update();
 
+    /** The part of ```prepare()``` that doesn't depend on where the state is. */
+    void prepareSettings(const juce::dsp::ProcessSpec& spec);
+
     void calculateCoefficients();
 
+    /** Recomputes the cached design terms from the current settings. */
+    void updateDesignTerms() noexcept;
+
+    /** The per-type part of the design, from the shared terms. */
+    static coefficientsType calculateCoefficients(filterType type, SampleType omega, SampleType cos, SampleType sin, SampleType alpha, SampleType a, SampleType sqrtA) noexcept;
+
+    /** The matched design of the second-order types; see ```BiquadsDesignMethod```. */
+    static coefficientsType calculateMatchedCoefficients(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate) noexcept;
+
+    /**
+     * @brief The squared magnitude of a type's analog prototype, at ```x```
+     * times its centre frequency.
+     */
+    static double getAnalogMagnitudeSquared(filterType type, double x, double zeta, double a) noexcept;
+
+    void advanceRamp() noexcept;
+
+    /** Starts the fade from the filter as it is now; see ```setTypeCrossfadeTime()```. */
+    void beginTypeCrossfade() noexcept;
+
+    void advanceFade() noexcept;
+
+    /**
+     * @brief Rewrites the state of ```channel``` from one topology into the
+     * equivalent state of another, for the current coefficients.
+     */
+    void convertState(std::size_t channel, transformationType from, transformationType to) noexcept;
+
+    /**
+     * @brief Filters a stereo pair on the channel(s), and with the mid/side
+     * matrix, that ```flags``` (```BiquadsStereoFlags```) ask for.
+     */
+    void processStereoPair(const SampleType* firstInput, const SampleType* secondInput, SampleType* firstOutput, SampleType* secondOutput, std::size_t numSamples, int flags) noexcept;
+
+    /**
+     * @brief Filters ```laneGroupSize``` channels, starting at
+     * ```firstChannel```, together: the state of the group is held in one
+     * lane per channel so that each step of the filter is a single SIMD
+     * operation across the group.
+     */
+    void processLaneGroup(const SampleType* const* inputs, SampleType* const* outputs, std::size_t firstChannel, std::size_t startSample, std::size_t numSamples) noexcept;
+
     SampleType directFormI              (int channel, SampleType inputValue);
     SampleType directFormII             (int channel, SampleType inputValue);
     SampleType directFormITransposed    (int channel, SampleType inputValue);
     SampleType directFormIITransposed   (int channel, SampleType inputValue);
 
     //==============================================================================
-    /** Unit-delay object(s). */
-    std::vector<SampleType> Wn_1, Wn_2, Xn_1, Xn_2, Yn_1, Yn_2;
+    /** Unit-delay object(s), one per channel each, carved from an arena. */
+    static constexpr std::size_t numStateVariables = 6;
+    StoneyDSP::Core::ArenaArray<SampleType> Wn_1, Wn_2, Xn_1, Xn_2, Yn_1, Yn_2;
+    StoneyDSP::Core::Arena ownArena;
 
     /** Coefficient gain(s). */
     StoneyDSP::Maths::Coefficient<SampleType> b0, b1, b2, a0, a1, a2;
 
-    /** Coefficient calculation(s). */
-    StoneyDSP::Maths::Coefficient<SampleType> b_0, b_1, b_2, a_0, a_1, a_2;
+    /** Coefficient glide(s). */
+    coefficientsType rampTarget, rampStep;
+    int rampSamplesRemaining = 0;
+
+    /** Type crossfade: the old filter, and the gain of the new one. */
+    std::unique_ptr<Biquads> outgoing;
+    double typeCrossfadeTime = 0.0;
+    int typeCrossfadeLength = 0, fadeSamplesRemaining = 0;
+    SampleType fadeGain { static_cast<SampleType>(0.0) }, fadeStep { static_cast<SampleType>(0.0) };
+
+    /** Optional shared source of coefficients. */
+    BiquadsCoefficientCache<SampleType>* coefficientCache = nullptr;
+
+    /** Design terms of the last full design, reused by ```setGainFast()```. */
+    SampleType omega, cos, sin, alpha, a, sqrtA { static_cast<SampleType>(0.0) };
+    bool designTermsAreValid = false;
 
     filterType filterTypeParamValue = { filterType::peak };
     transformationType transformationParamValue = { transformationType::directFormIItransposed };
+    designMethodType designMethod = { designMethodType::bilinear };
 
     //==============================================================================
     /** Initialised parameter(s) */
@@ -195,8 +589,6 @@ private:
         , g = static_cast<SampleType>(0.0)
     ;
 
-    SampleType omega, cos, sin, tan, alpha, a, sqrtA { static_cast<SampleType>(0.0) };
-
     //==============================================================================
     /** Initialised constant */
     const SampleType zero       = StoneyDSP::Maths::Constants<SampleType>::zero;
@@ -208,6 +600,8 @@ private:
     const SampleType pi         = juce::MathConstants<SampleType>::pi;
     double sampleRate = 0.0;
 
+    template <typename> friend class Biquads;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Biquads)
 };
 
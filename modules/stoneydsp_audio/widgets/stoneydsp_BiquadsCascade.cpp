@@ -0,0 +1,330 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCascade.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Butterworth and Linkwitz-Riley filters of up to 96dB/octave, run as one fused cascade of Biquads sections.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+BiquadsCascade<SampleType>::BiquadsCascade()
+{
+}
+
+template <typename SampleType>
+int BiquadsCascade<SampleType>::calculateSections(filterType type, responseType response, SampleType frequency, int slope, double sampleRate, coefficientsType* sections) noexcept
+{
+    constexpr auto one          = StoneyDSP::Maths::Constants<SampleType>::one;
+    constexpr auto two          = StoneyDSP::Maths::Constants<SampleType>::two;
+    constexpr auto pi           = juce::MathConstants<SampleType>::pi;
+
+    jassert(sampleRate > 0.0);
+    jassert(sections != nullptr);
+
+    const bool isHighPass = type == filterType::highPass2 || type == filterType::highPass1;
+    const bool isLinkwitzRiley = response == responseType::linkwitzRiley;
+
+    // Linkwitz-Riley is a Butterworth filter of half the order, run twice.
+    const auto stepSlope = isLinkwitzRiley ? 12 : 6;
+    const auto order = juce::jlimit(1, maxSlope / stepSlope, slope / stepSlope);
+    const auto numPasses = isLinkwitzRiley ? 2 : 1;
+
+    const auto maxFrequency = static_cast<SampleType>(sampleRate / 2.125);
+    const auto minFrequency = static_cast<SampleType>(sampleRate / 24576.0);
+    const auto omega = juce::jlimit(minFrequency, maxFrequency, frequency) * ((pi * two) / static_cast<SampleType>(sampleRate));
+    const auto cos = std::cos(omega);
+    const auto sin = std::sin(omega);
+
+    int numSections = 0;
+
+    for (int pass = 0; pass < numPasses; ++pass)
+    {
+        for (int pole = 1; pole <= order / 2; ++pole)
+        {
+            // Q = 1 / (2 cos(theta)), so alpha = sin / (2Q) = sin * cos(theta).
+            const auto theta = static_cast<SampleType>(2 * pole - 1 + (order % 2)) * pi / static_cast<SampleType>(2 * order);
+            const auto alpha = sin * std::cos(theta);
+            const auto a0 = one + alpha;
+
+            auto& section = sections[numSections++];
+
+            section.b0 = (isHighPass ? (one + cos) : (one - cos)) / (two * a0);
+            section.b1 = (isHighPass ? -(one + cos) : (one - cos)) / a0;
+            section.b2 = section.b0;
+            section.a1 = (two * cos) / a0;
+            section.a2 = -(one - alpha) / a0;
+        }
+
+        if ((order % 2) != 0)
+        {
+            // The real pole; bilinear, with the cutoff pre-warped.
+            const auto k = std::tan(omega / two);
+
+            auto& section = sections[numSections++];
+
+            section.b0 = (isHighPass ? one : k) / (one + k);
+            section.b1 = isHighPass ? -section.b0 : section.b0;
+            section.b2 = static_cast<SampleType>(0.0);
+            section.a1 = (one - k) / (one + k);
+            section.a2 = static_cast<SampleType>(0.0);
+        }
+    }
+
+    jassert(numSections <= maxSections);
+
+    return numSections;
+}
+
+template <typename SampleType>
+void BiquadsCascade<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.sampleRate > 0);
+    jassert(spec.numChannels > 0);
+
+    // Preparing again for the same channels (e.g. at a new sample rate) keeps
+    // the state where it is, wherever it was carved from.
+    if (state.size() != spec.numChannels)
+    {
+        ownArena.prepare(getArenaSize(spec));
+        state = ownArena.allocateArray<ChannelState>(spec.numChannels);
+    }
+
+    sampleRate = spec.sampleRate;
+
+    reset();
+
+    numSections = calculateSections(type, response, frequency, slope, sampleRate, sections.data());
+}
+
+template <typename SampleType>
+void BiquadsCascade<SampleType>::prepare(const juce::dsp::ProcessSpec& spec, StoneyDSP::Core::Arena& arena)
+{
+    jassert(spec.numChannels > 0);
+
+    state = arena.allocateArray<ChannelState>(spec.numChannels);
+
+    // The arena was prepared without room for this cascade; see getArenaSize().
+    jassert(state.size() == spec.numChannels);
+
+    prepare(spec);
+}
+
+template <typename SampleType>
+std::size_t BiquadsCascade<SampleType>::getArenaSize(const juce::dsp::ProcessSpec& spec) const noexcept
+{
+    return StoneyDSP::Core::Arena::getSizeFor<ChannelState>(spec.numChannels);
+}
+
+template <typename SampleType>
+void BiquadsCascade<SampleType>::reset() noexcept
+{
+    for (auto& channelState : state)
+    {
+        channelState.s1.fill(static_cast<SampleType>(0.0));
+        channelState.s2.fill(static_cast<SampleType>(0.0));
+    }
+}
+
+template <typename SampleType>
+void BiquadsCascade<SampleType>::setParameters(filterType newType, responseType newResponse, SampleType newFrequency, int newSlope) noexcept
+{
+    if (newType == type && newResponse == response && newFrequency == frequency && newSlope == slope)
+        return;
+
+    // A different response or direction leaves nothing useful in the state.
+    if (newType != type || newResponse != response)
+        reset();
+
+    type = newType;
+    response = newResponse;
+    frequency = newFrequency;
+    slope = newSlope;
+
+    if (sampleRate <= 0.0)
+        return;
+
+    const auto oldNumSections = numSections;
+    numSections = calculateSections(type, response, frequency, slope, sampleRate, sections.data());
+
+    // Sections that have just been added start from silence.
+    for (auto& channelState : state)
+    {
+        for (auto i = oldNumSections; i < numSections; ++i)
+        {
+            channelState.s1[static_cast<std::size_t>(i)] = static_cast<SampleType>(0.0);
+            channelState.s2[static_cast<std::size_t>(i)] = static_cast<SampleType>(0.0);
+        }
+    }
+}
+
+template <typename SampleType>
+SampleType BiquadsCascade<SampleType>::processSample(int channel, SampleType inputValue) noexcept
+{
+    jassert(juce::isPositiveAndBelow(channel, state.size()));
+
+    auto& channelState = state[static_cast<std::size_t>(channel)];
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(numSections); ++i)
+    {
+        const auto& section = sections[i];
+        const auto output = (inputValue * section.b0) + channelState.s1[i];
+
+        channelState.s1[i] = (inputValue * section.b1) + channelState.s2[i] + (output * section.a1);
+        channelState.s2[i] = (inputValue * section.b2) +                      (output * section.a2);
+
+        inputValue = output;
+    }
+
+    return inputValue;
+}
+
+template <typename SampleType>
+void BiquadsCascade<SampleType>::processChannel(const SampleType* input, SampleType* output, std::size_t channel, std::size_t numSamples) noexcept
+{
+    jassert(channel < state.size());
+
+    // The coefficients and state are copied to locals so that the compiler
+    // can keep the whole chain in registers for the length of the block.
+    const auto count = static_cast<std::size_t>(numSections);
+    auto channelState = state[channel];
+    const auto chain = sections;
+
+    for (std::size_t n = 0; n < numSamples; ++n)
+    {
+        auto sample = input[n];
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto& section = chain[i];
+            const auto y = (sample * section.b0) + channelState.s1[i];
+
+            channelState.s1[i] = (sample * section.b1) + channelState.s2[i] + (y * section.a1);
+            channelState.s2[i] = (sample * section.b2) +                      (y * section.a2);
+
+            sample = y;
+        }
+
+        output[n] = sample;
+    }
+
+    state[channel] = channelState;
+}
+
+template <typename SampleType>
+void BiquadsCascade<SampleType>::processStereoPair(const SampleType* firstInput, const SampleType* secondInput, SampleType* firstOutput, SampleType* secondOutput, std::size_t numSamples, int flags) noexcept
+{
+    jassert(state.size() >= 2);
+
+    const bool filterFirst  = (flags & filterFirstChannel)  != 0;
+    const bool filterSecond = (flags & filterSecondChannel) != 0;
+    const bool encode       = (flags & encodeMidSide)       != 0;
+    const bool decode       = (flags & decodeMidSide)       != 0;
+
+    const auto half = static_cast<SampleType>(0.5);
+
+    for (std::size_t i = 0; i < numSamples; ++i)
+    {
+        auto first  = firstInput[i];
+        auto second = secondInput[i];
+
+        if (encode)
+        {
+            const auto mid  = (first + second) * half;
+            const auto side = (first - second) * half;
+            first = mid, second = side;
+        }
+
+        if (filterFirst)
+            first = processSample(0, first);
+
+        if (filterSecond)
+            second = processSample(1, second);
+
+        if (decode)
+        {
+            const auto left  = first + second;
+            const auto right = first - second;
+            first = left, second = right;
+        }
+
+        firstOutput[i]  = first;
+        secondOutput[i] = second;
+    }
+}
+
+template <typename SampleType>
+template <typename OtherSampleType>
+void BiquadsCascade<SampleType>::copyStateFrom(const BiquadsCascade<OtherSampleType>& other) noexcept
+{
+    jassert(sampleRate == other.sampleRate);
+    jassert(state.size() == other.state.size());
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(maxSections); ++i)
+    {
+        sections[i].b0 = static_cast<SampleType>(other.sections[i].b0);
+        sections[i].b1 = static_cast<SampleType>(other.sections[i].b1);
+        sections[i].b2 = static_cast<SampleType>(other.sections[i].b2);
+        sections[i].a1 = static_cast<SampleType>(other.sections[i].a1);
+        sections[i].a2 = static_cast<SampleType>(other.sections[i].a2);
+    }
+
+    const auto numChannels = std::min(state.size(), other.state.size());
+
+    for (std::size_t channel = 0; channel < numChannels; ++channel)
+    {
+        for (std::size_t i = 0; i < static_cast<std::size_t>(maxSections); ++i)
+        {
+            state[channel].s1[i] = static_cast<SampleType>(other.state[channel].s1[i]);
+            state[channel].s2[i] = static_cast<SampleType>(other.state[channel].s2[i]);
+        }
+    }
+
+    numSections = other.numSections;
+    type = other.type;
+    response = other.response;
+    frequency = static_cast<SampleType>(other.frequency);
+    slope = other.slope;
+}
+
+//==============================================================================
+template class BiquadsCascade<float>;
+template class BiquadsCascade<double>;
+
+template void BiquadsCascade<float>::copyStateFrom<double>(const BiquadsCascade<double>&) noexcept;
+template void BiquadsCascade<double>::copyStateFrom<float>(const BiquadsCascade<float>&) noexcept;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,235 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCascade.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Butterworth and Linkwitz-Riley filters of up to 96dB/octave, run as one fused cascade of Biquads sections.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/** @brief The pole layouts that ```BiquadsCascade``` can design. */
+enum struct BiquadsCascadeResponse
+{
+    butterworth = 0,
+    linkwitzRiley = 1
+};
+
+/**
+ * @brief A steep low- or high-pass filter: a Butterworth or Linkwitz-Riley
+ * response of up to 96dB/octave, designed as a chain of Biquads sections with
+ * the right Q for each.
+ *
+ * Every section runs in the one kernel: each sample passes through the whole
+ * chain before the next is read, with the state of every section kept
+ * together, so a 96dB/octave filter costs eight sections in a single pass
+ * over the buffer rather than eight passes through eight ```Biquads```. The
+ * sections use the transposed direct form II, as ```Biquads``` does by
+ * default.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class BiquadsCascade
+{
+public:
+    using filterType            = StoneyDSP::Audio::BiquadsFilterType;
+    using responseType          = StoneyDSP::Audio::BiquadsCascadeResponse;
+    using coefficientsType      = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
+
+    /** The most sections in one chain; enough for 96dB/octave. */
+    static constexpr int maxSections = 8;
+    /** The steepest slope, in dB/octave. */
+    static constexpr int maxSlope = 96;
+
+    //==============================================================================
+    /** Constructor. */
+    BiquadsCascade();
+
+    //==============================================================================
+    /**
+     * @brief Designs the sections of a low- or high-pass filter.
+     *
+     * A Butterworth filter of N x 6dB/octave has N poles: N / 2 sections with
+     * Q = 1 / (2 cos(theta)), plus one first-order section when N is odd. A
+     * Linkwitz-Riley filter is the same Butterworth filter at half the slope,
+     * twice over, so that it is 6dB down at the cutoff and its low- and
+     * high-pass outputs sum flat.
+     *
+     * @param type ```lowPass2``` or ```highPass2``` (or their first-order versions).
+     * @param response Butterworth or Linkwitz-Riley.
+     * @param frequency the cutoff frequency in Hz.
+     * @param slope the slope in dB/octave: a multiple of 6 (Butterworth) or
+     * of 12 (Linkwitz-Riley) up to ```maxSlope```.
+     * @param sampleRate the sample rate that the filter runs at.
+     * @param sections receives up to ```maxSections``` sets of coefficients.
+     * @return the number of sections used.
+     */
+    static int calculateSections(filterType type, responseType response, SampleType frequency, int slope, double sampleRate, coefficientsType* sections) noexcept;
+
+    //==============================================================================
+    /**
+     * @brief Initialises the processor. The state is kept in an arena of the
+     * cascade's own, which is only allocated the first time, or when the
+     * channel count changes.
+     */
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    /**
+     * @brief Initialises the processor, with its state carved from a shared
+     * arena that was prepared with room for at least ```getArenaSize()```.
+     * Does not allocate.
+     */
+    void prepare(const juce::dsp::ProcessSpec& spec, StoneyDSP::Core::Arena& arena);
+    /** Returns the room that ```prepare()``` takes from an arena, in bytes. */
+    std::size_t getArenaSize(const juce::dsp::ProcessSpec& spec) const noexcept;
+    /**
+     * @brief Returns the number of times the cascade's own arena has gone to
+     * the heap; see ```StoneyDSP::Core::Arena::getNumAllocations()```.
+     */
+    int getNumAllocations() const noexcept { return ownArena.getNumAllocations(); }
+
+    /** Resets the internal state variables of the processor. */
+    void reset() noexcept;
+
+    /**
+     * @brief Takes over the sections, state and settings of a cascade of the
+     * other precision. Both must be prepared for the same sample rate and
+     * channel count; nothing is allocated.
+     */
+    template <typename OtherSampleType>
+    void copyStateFrom(const BiquadsCascade<OtherSampleType>& other) noexcept;
+
+    /**
+     * @brief Redesigns the chain. Does not allocate; the state of sections
+     * that stay in use is kept, so the slope and frequency can be moved while
+     * running.
+     */
+    void setParameters(filterType newType, responseType newResponse, SampleType newFrequency, int newSlope) noexcept;
+
+    int getNumSections() const noexcept { return numSections; }
+    const coefficientsType& getSection(int index) const noexcept { return sections[static_cast<std::size_t>(index)]; }
+
+    //==============================================================================
+    /** Processes the input and output samples supplied in the processing context. */
+    template <typename ProcessContext>
+    void process (const ProcessContext& context) noexcept
+    {
+        processChannels (context, 0);
+    }
+
+    /**
+     * @brief Processes a context that holds only some of the chain's
+     * channels, from ```firstChannel``` on. Channels share nothing but the
+     * sections, so different channels can be run on different threads at
+     * once.
+     */
+    template <typename ProcessContext>
+    void processChannels (const ProcessContext& context, size_t firstChannel) noexcept
+    {
+        const auto& inputBlock = context.getInputBlock();
+        auto& outputBlock      = context.getOutputBlock();
+        const auto numChannels = outputBlock.getNumChannels();
+        const auto numSamples  = outputBlock.getNumSamples();
+
+        jassert (inputBlock.getNumChannels() == numChannels);
+        jassert (inputBlock.getNumSamples()  == numSamples);
+
+        if (context.isBypassed)
+        {
+            outputBlock.copyFrom (inputBlock);
+            return;
+        }
+
+        for (size_t channel = 0; channel < numChannels; ++channel)
+            processChannel (inputBlock.getChannelPointer (channel), outputBlock.getChannelPointer (channel), firstChannel + channel, numSamples);
+    }
+
+    /**
+     * @brief Processes a stereo pair, with the same ```BiquadsStereoFlags```
+     * as ```Biquads::processStereo()```.
+     */
+    template <typename ProcessContext>
+    void processStereo (const ProcessContext& context, int flags) noexcept
+    {
+        const auto& inputBlock = context.getInputBlock();
+        auto& outputBlock      = context.getOutputBlock();
+
+        jassert (inputBlock.getNumChannels() == 2 && outputBlock.getNumChannels() == 2);
+        jassert (inputBlock.getNumSamples()  == outputBlock.getNumSamples());
+
+        if (context.isBypassed)
+        {
+            outputBlock.copyFrom (inputBlock);
+            return;
+        }
+
+        processStereoPair (inputBlock .getChannelPointer (0), inputBlock .getChannelPointer (1),
+                           outputBlock.getChannelPointer (0), outputBlock.getChannelPointer (1),
+                           outputBlock.getNumSamples(), flags);
+    }
+
+    /** Runs one sample through every section. */
+    SampleType processSample (int channel, SampleType inputValue) noexcept;
+
+private:
+    //==============================================================================
+    void processChannel(const SampleType* input, SampleType* output, std::size_t channel, std::size_t numSamples) noexcept;
+    void processStereoPair(const SampleType* firstInput, const SampleType* secondInput, SampleType* firstOutput, SampleType* secondOutput, std::size_t numSamples, int flags) noexcept;
+
+    /** Both state variables of every section, for one channel. */
+    struct ChannelState
+    {
+        std::array<SampleType, maxSections> s1 {};
+        std::array<SampleType, maxSections> s2 {};
+    };
+
+    std::array<coefficientsType, maxSections> sections {};
+    int numSections = 1;
+
+    StoneyDSP::Core::ArenaArray<ChannelState> state;
+    StoneyDSP::Core::Arena ownArena;
+
+    filterType type = filterType::lowPass2;
+    responseType response = responseType::butterworth;
+    SampleType frequency = static_cast<SampleType>(1000.0);
+    int slope = 12;
+    double sampleRate = 0.0;
+
+    template <typename> friend class BiquadsCascade;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiquadsCascade)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,206 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCoefficientCache.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief A process-wide cache of Biquads coefficients.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+BiquadsCoefficientCache<SampleType>::BiquadsCoefficientCache(std::size_t newCapacity)
+: capacity(juce::nextPowerOfTwo(static_cast<int>(juce::jmax(maxProbes, newCapacity))))
+, entries(std::make_unique<Entry[]>(capacity))
+{
+}
+
+template <typename SampleType>
+BiquadsCoefficientCache<SampleType>& BiquadsCoefficientCache<SampleType>::getInstance()
+{
+    static BiquadsCoefficientCache instance;
+    return instance;
+}
+
+template <typename SampleType>
+void BiquadsCoefficientCache<SampleType>::resetCounters() noexcept
+{
+    hits.store(0, std::memory_order_relaxed);
+    misses.store(0, std::memory_order_relaxed);
+}
+
+//==============================================================================
+template <typename SampleType>
+typename BiquadsCoefficientCache<SampleType>::coefficientsType BiquadsCoefficientCache<SampleType>::getCoefficients(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate) noexcept
+{
+    const auto key = makeKey(type, frequency, resonance, gain, sampleRate);
+
+    coefficientsType coefficients;
+
+    if (lookup(key, coefficients))
+    {
+        hits.fetch_add(1, std::memory_order_relaxed);
+        return coefficients;
+    }
+
+    misses.fetch_add(1, std::memory_order_relaxed);
+
+    // Design from the quantised settings, not the requested ones.
+    coefficients = Biquads<SampleType>::calculateCoefficients(type,
+                                                              static_cast<SampleType>(std::exp2(key.frequency / 12000.0)),
+                                                              static_cast<SampleType>(key.resonance * 0.001),
+                                                              static_cast<SampleType>(key.gain * 0.01),
+                                                              sampleRate);
+    insert(key, coefficients);
+
+    return coefficients;
+}
+
+//==============================================================================
+template <typename SampleType>
+typename BiquadsCoefficientCache<SampleType>::Key BiquadsCoefficientCache<SampleType>::makeKey(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate) noexcept
+{
+    Key key;
+
+    key.type        = static_cast<juce::int32>(type);
+    key.frequency   = static_cast<juce::int32>(std::lround(std::log2(juce::jmax(static_cast<double>(frequency), 1.0)) * 12000.0));
+    key.resonance   = static_cast<juce::int32>(std::lround(static_cast<double>(resonance) * 1000.0));
+    key.gain        = static_cast<juce::int32>(std::lround(static_cast<double>(gain) * 100.0));
+    key.sampleRate  = sampleRate;
+
+    return key;
+}
+
+template <typename SampleType>
+std::size_t BiquadsCoefficientCache<SampleType>::getHash(const Key& key) noexcept
+{
+    auto hash = static_cast<juce::uint64>(std::lround(key.sampleRate));
+
+    for (auto value : { key.type, key.frequency, key.resonance, key.gain })
+        hash = (hash ^ static_cast<juce::uint32>(value)) * 0x100000001b3ull;
+
+    return static_cast<std::size_t>(hash ^ (hash >> 29));
+}
+
+template <typename SampleType>
+bool BiquadsCoefficientCache<SampleType>::lookup(const Key& key, coefficientsType& coefficients) const noexcept
+{
+    const auto mask = capacity - 1;
+    const auto home = getHash(key);
+
+    for (std::size_t probe = 0; probe < maxProbes; ++probe)
+    {
+        const auto& entry = entries[(home + probe) & mask];
+
+        const auto before = entry.sequence.load(std::memory_order_acquire);
+
+        // Empty; the key was never stored further along.
+        if (before == 0)
+            return false;
+
+        // Being written; treat as a miss rather than wait.
+        if ((before & 1) != 0)
+            continue;
+
+        Key stored;
+        stored.type         = entry.type        .load(std::memory_order_relaxed);
+        stored.frequency    = entry.frequency   .load(std::memory_order_relaxed);
+        stored.resonance    = entry.resonance   .load(std::memory_order_relaxed);
+        stored.gain         = entry.gain        .load(std::memory_order_relaxed);
+        stored.sampleRate   = entry.sampleRate  .load(std::memory_order_relaxed);
+
+        coefficients.b0     = entry.b0.load(std::memory_order_relaxed);
+        coefficients.b1     = entry.b1.load(std::memory_order_relaxed);
+        coefficients.b2     = entry.b2.load(std::memory_order_relaxed);
+        coefficients.a1     = entry.a1.load(std::memory_order_relaxed);
+        coefficients.a2     = entry.a2.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (entry.sequence.load(std::memory_order_relaxed) == before && stored == key)
+            return true;
+    }
+
+    return false;
+}
+
+template <typename SampleType>
+void BiquadsCoefficientCache<SampleType>::insert(const Key& key, const coefficientsType& coefficients) noexcept
+{
+    const auto mask = capacity - 1;
+    const auto home = getHash(key);
+
+    // Take the first empty entry along the probe sequence, or else replace
+    // the home entry.
+    auto* target = &entries[home & mask];
+
+    for (std::size_t probe = 0; probe < maxProbes; ++probe)
+    {
+        auto& entry = entries[(home + probe) & mask];
+
+        if (entry.sequence.load(std::memory_order_relaxed) == 0)
+        {
+            target = &entry;
+            break;
+        }
+    }
+
+    auto before = target->sequence.load(std::memory_order_relaxed);
+
+    if ((before & 1) != 0 || ! target->sequence.compare_exchange_strong(before, before + 1, std::memory_order_relaxed))
+        return;
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    target->type        .store(key.type,        std::memory_order_relaxed);
+    target->frequency   .store(key.frequency,   std::memory_order_relaxed);
+    target->resonance   .store(key.resonance,   std::memory_order_relaxed);
+    target->gain        .store(key.gain,        std::memory_order_relaxed);
+    target->sampleRate  .store(key.sampleRate,  std::memory_order_relaxed);
+
+    target->b0.store(coefficients.b0, std::memory_order_relaxed);
+    target->b1.store(coefficients.b1, std::memory_order_relaxed);
+    target->b2.store(coefficients.b2, std::memory_order_relaxed);
+    target->a1.store(coefficients.a1, std::memory_order_relaxed);
+    target->a2.store(coefficients.a2, std::memory_order_relaxed);
+
+    target->sequence.store(before + 2, std::memory_order_release);
+}
+
+//==============================================================================
+template class BiquadsCoefficientCache<float>;
+template class BiquadsCoefficientCache<double>;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,147 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCoefficientCache.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief A process-wide cache of Biquads coefficients.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief A fixed-size, lock-free cache of designed ```Biquads```
+ * coefficients, shared by every filter (and every plugin instance) in the
+ * process; see ```getInstance()```.
+ *
+ * Settings are quantised before they are used as a key (frequency to a tenth
+ * of a cent, resonance to 0.001, gain to 0.01dB) and the coefficients are
+ * designed for the quantised settings, so every user of the same key gets
+ * exactly the same filter, whoever designed it first.
+ *
+ * Each entry is guarded by its own sequence lock. Readers never wait; a read
+ * that overlaps a write simply counts as a miss. Writers that collide on an
+ * entry give up rather than wait, since the cache is only an optimisation.
+ * When a key's probe sequence is full, its home entry is replaced, so memory
+ * use stays at ```getSizeInBytes()``` however many settings are seen.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class BiquadsCoefficientCache
+{
+public:
+    using filterType            = StoneyDSP::Audio::BiquadsFilterType;
+    using coefficientsType      = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
+
+    /** The default number of entries. */
+    static constexpr std::size_t defaultCapacity = 4096;
+
+    //==============================================================================
+    /**
+     * @brief Construct a new BiquadsCoefficientCache object.
+     *
+     * @param capacity the number of entries, rounded up to a power of two.
+     */
+    explicit BiquadsCoefficientCache(std::size_t capacity = defaultCapacity);
+
+    /** Returns the cache shared by the whole process, for this precision. */
+    static BiquadsCoefficientCache& getInstance();
+
+    //==============================================================================
+    /**
+     * @brief Returns the coefficients for the given settings, from the cache
+     * if possible, otherwise designing (and caching) them. Lock-free and
+     * allocation-free; safe to call from any number of audio threads.
+     */
+    coefficientsType getCoefficients(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate) noexcept;
+
+    //==============================================================================
+    /** Returns the number of lookups that were found in the cache. */
+    juce::uint64 getNumHits()   const noexcept { return hits.load(std::memory_order_relaxed); }
+    /** Returns the number of lookups that had to be designed. */
+    juce::uint64 getNumMisses() const noexcept { return misses.load(std::memory_order_relaxed); }
+    /** Sets both counters back to zero. */
+    void resetCounters() noexcept;
+
+    /** Returns the number of entries. */
+    std::size_t getCapacity()       const noexcept { return capacity; }
+    /** Returns the memory used by the entries, in bytes. */
+    std::size_t getSizeInBytes()    const noexcept { return capacity * sizeof(Entry); }
+
+private:
+    //==============================================================================
+    struct Key
+    {
+        juce::int32 type, frequency, resonance, gain;
+        double sampleRate;
+
+        bool operator== (const Key& other) const noexcept
+        {
+            return type == other.type && frequency == other.frequency && resonance == other.resonance
+                && gain == other.gain && sampleRate == other.sampleRate;
+        }
+    };
+
+    /**
+     * @brief One cache entry. Every field is atomic so that the optimistic
+     * reads are well-defined; the sequence number is odd while a write is in
+     * progress, and zero while the entry is empty.
+     */
+    struct Entry
+    {
+        std::atomic<juce::uint32> sequence { 0 };
+        std::atomic<juce::int32> type { -1 }, frequency { 0 }, resonance { 0 }, gain { 0 };
+        std::atomic<double> sampleRate { 0.0 };
+        std::atomic<SampleType> b0 { 1 }, b1 { 0 }, b2 { 0 }, a1 { 0 }, a2 { 0 };
+    };
+
+    static Key makeKey(filterType type, SampleType frequency, SampleType resonance, SampleType gain, double sampleRate) noexcept;
+    static std::size_t getHash(const Key& key) noexcept;
+
+    bool lookup(const Key& key, coefficientsType& coefficients) const noexcept;
+    void insert(const Key& key, const coefficientsType& coefficients) noexcept;
+
+    /** The number of entries searched for a key before giving up. */
+    static constexpr std::size_t maxProbes = 8;
+
+    const std::size_t capacity;
+    std::unique_ptr<Entry[]> entries;
+
+    std::atomic<juce::uint64> hits { 0 }, misses { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiquadsCoefficientCache)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
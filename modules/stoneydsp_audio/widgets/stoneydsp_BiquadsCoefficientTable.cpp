@@ -0,0 +1,179 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCoefficientTable.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Precomputed Biquads coefficients over log-frequency.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+BiquadsCoefficientTable<SampleType>::BiquadsCoefficientTable(filterType newType, SampleType newResonance, SampleType newGain, double newSampleRate, int size)
+: type(newType)
+, resonance(newResonance)
+, gain(newGain)
+, sampleRate(newSampleRate)
+{
+    jassert(sampleRate > 0.0);
+
+    const auto numPoints = static_cast<std::size_t>(juce::jlimit(minSize, maxSize, size));
+
+    // The same range that Biquads clamps its frequency to.
+    minFrequency        = static_cast<SampleType>(sampleRate / 24576.0);
+    maxFrequency        = static_cast<SampleType>(sampleRate / 2.125);
+    logMinFrequency     = std::log(minFrequency);
+    positionsPerLogHz   = static_cast<SampleType>(numPoints - 1) / (std::log(maxFrequency) - logMinFrequency);
+
+    std::vector<filterType> types       (numPoints, type);
+    std::vector<SampleType> frequencies (numPoints);
+    std::vector<SampleType> resonances  (numPoints, resonance);
+    std::vector<SampleType> gains       (numPoints, gain);
+
+    for (std::size_t i = 0; i < numPoints; ++i)
+        frequencies[i] = std::exp(logMinFrequency + static_cast<SampleType>(i) / positionsPerLogHz);
+
+    table.resize(numPoints);
+
+    Biquads<SampleType>::calculateCoefficients(types.data(), frequencies.data(), resonances.data(), gains.data(), table.data(), numPoints, sampleRate);
+}
+
+template <typename SampleType>
+std::shared_ptr<const BiquadsCoefficientTable<SampleType>> BiquadsCoefficientTable<SampleType>::getShared(filterType type, SampleType resonance, SampleType gain, double sampleRate, int size)
+{
+    static juce::CriticalSection lock;
+    static std::vector<std::weak_ptr<const BiquadsCoefficientTable>> registry;
+
+    const juce::ScopedLock scopedLock(lock);
+
+    const auto numPoints = juce::jlimit(minSize, maxSize, size);
+
+    // Tables are only kept alive by their users; forget the ones nobody holds.
+    registry.erase(std::remove_if(registry.begin(), registry.end(), [](const auto& entry) { return entry.expired(); }), registry.end());
+
+    for (const auto& entry : registry)
+    {
+        if (auto table = entry.lock())
+        {
+            if (table->type == type && table->resonance == resonance && table->gain == gain
+             && table->sampleRate == sampleRate && table->getSize() == numPoints)
+                return table;
+        }
+    }
+
+    auto table = std::make_shared<const BiquadsCoefficientTable>(type, resonance, gain, sampleRate, numPoints);
+    registry.push_back(table);
+    return table;
+}
+
+//==============================================================================
+template <typename SampleType>
+SampleType BiquadsCoefficientTable<SampleType>::getPosition(SampleType frequency) const noexcept
+{
+    const auto hz = juce::jlimit(minFrequency, maxFrequency, frequency);
+    const auto position = (std::log(hz) - logMinFrequency) * positionsPerLogHz;
+
+    return juce::jlimit(static_cast<SampleType>(0.0), static_cast<SampleType>(table.size() - 1), position);
+}
+
+template <typename SampleType>
+typename BiquadsCoefficientTable<SampleType>::coefficientsType BiquadsCoefficientTable<SampleType>::getLinear(SampleType frequency) const noexcept
+{
+    const auto position = getPosition(frequency);
+    const auto index    = std::min(static_cast<std::size_t>(position), table.size() - 2);
+    const auto t        = position - static_cast<SampleType>(index);
+
+    const auto& x0 = table[index];
+    const auto& x1 = table[index + 1];
+
+    coefficientsType coefficients;
+
+    coefficients.b0 = x0.b0 + t * (x1.b0 - x0.b0);
+    coefficients.b1 = x0.b1 + t * (x1.b1 - x0.b1);
+    coefficients.b2 = x0.b2 + t * (x1.b2 - x0.b2);
+    coefficients.a1 = x0.a1 + t * (x1.a1 - x0.a1);
+    coefficients.a2 = x0.a2 + t * (x1.a2 - x0.a2);
+
+    return coefficients;
+}
+
+template <typename SampleType>
+typename BiquadsCoefficientTable<SampleType>::coefficientsType BiquadsCoefficientTable<SampleType>::getCubic(SampleType frequency) const noexcept
+{
+    const auto position = getPosition(frequency);
+    const auto last     = table.size() - 1;
+    const auto index    = std::min(static_cast<std::size_t>(position), last - 1);
+    const auto t        = position - static_cast<SampleType>(index);
+
+    // Catmull-Rom, repeating the end points at the edges of the table.
+    const auto& xm1 = table[index > 0 ? index - 1 : 0];
+    const auto& x0  = table[index];
+    const auto& x1  = table[index + 1];
+    const auto& x2  = table[std::min(index + 2, last)];
+
+    const auto half = static_cast<SampleType>(0.5);
+
+    auto interpolate = [t, half] (SampleType ym1, SampleType y0, SampleType y1, SampleType y2)
+    {
+        const auto c1 = half * (y1 - ym1);
+        const auto c2 = ym1 - static_cast<SampleType>(2.5) * y0 + static_cast<SampleType>(2.0) * y1 - half * y2;
+        const auto c3 = half * (y2 - ym1) + static_cast<SampleType>(1.5) * (y0 - y1);
+
+        return ((c3 * t + c2) * t + c1) * t + y0;
+    };
+
+    coefficientsType coefficients;
+
+    coefficients.b0 = interpolate(xm1.b0, x0.b0, x1.b0, x2.b0);
+    coefficients.b1 = interpolate(xm1.b1, x0.b1, x1.b1, x2.b1);
+    coefficients.b2 = interpolate(xm1.b2, x0.b2, x1.b2, x2.b2);
+    coefficients.a1 = interpolate(xm1.a1, x0.a1, x1.a1, x2.a1);
+    coefficients.a2 = interpolate(xm1.a2, x0.a2, x1.a2, x2.a2);
+
+    return coefficients;
+}
+
+template <typename SampleType>
+void BiquadsCoefficientTable<SampleType>::getLinear(const SampleType* frequencies, coefficientsType* coefficients, std::size_t numSamples) const noexcept
+{
+    for (std::size_t i = 0; i < numSamples; ++i)
+        coefficients[i] = getLinear(frequencies[i]);
+}
+
+//==============================================================================
+template class BiquadsCoefficientTable<float>;
+template class BiquadsCoefficientTable<double>;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
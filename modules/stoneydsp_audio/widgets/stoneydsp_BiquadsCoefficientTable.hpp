@@ -0,0 +1,132 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCoefficientTable.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Precomputed Biquads coefficients over log-frequency.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief A table of ```Biquads``` coefficients for one filter type,
+ * resonance and gain, sampled densely over log-frequency at one sample rate.
+ *
+ * Looking a frequency up costs one ```std::log``` and an interpolation,
+ * instead of the trigonometry, power and divides of a full design, which
+ * makes per-sample (audio-rate) frequency modulation affordable. Interpolating
+ * linearly between two stable filters always gives a stable filter; the
+ * cubic lookup can overshoot very slightly between table points.
+ *
+ * Tables are immutable once built, so one table can be shared between any
+ * number of filters and threads; see ```getShared()```.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class BiquadsCoefficientTable
+{
+public:
+    using filterType            = StoneyDSP::Audio::BiquadsFilterType;
+    using coefficientsType      = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
+
+    /** The default number of table points; about 1% apart in frequency. */
+    static constexpr int defaultSize    = 1024;
+    /** The smallest and largest number of table points. */
+    static constexpr int minSize        = 16;
+    static constexpr int maxSize        = 8192;
+
+    //==============================================================================
+    /**
+     * @brief Builds a new table, covering every frequency that ```Biquads```
+     * accepts at this sample rate. This allocates, so call it from
+     * ```prepare()``` or another non-realtime thread.
+     *
+     * @param type the filter type.
+     * @param resonance the resonance from 0 (min) to 1 (max).
+     * @param gain the gain in Decibels.
+     * @param sampleRate the sample rate that the filter runs at.
+     * @param size the number of table points, clamped to [minSize, maxSize].
+     */
+    BiquadsCoefficientTable(filterType type, SampleType resonance, SampleType gain, double sampleRate, int size = defaultSize);
+
+    /**
+     * @brief Returns a table with the given settings, building it only if no
+     * other user is already holding one. Call from a non-realtime thread.
+     */
+    static std::shared_ptr<const BiquadsCoefficientTable> getShared(filterType type, SampleType resonance, SampleType gain, double sampleRate, int size = defaultSize);
+
+    //==============================================================================
+    /** Returns the coefficients at a frequency in Hz, interpolated linearly. */
+    coefficientsType getLinear(SampleType frequency) const noexcept;
+    /** Returns the coefficients at a frequency in Hz, interpolated cubically. */
+    coefficientsType getCubic(SampleType frequency) const noexcept;
+
+    /**
+     * @brief Looks up a whole block of frequencies at once, interpolating
+     * linearly, e.g. to feed ```Biquads::process(context, coefficients)```.
+     *
+     * @param frequencies the frequency of each sample, in Hz.
+     * @param coefficients receives the coefficients of each sample.
+     * @param numSamples the length of both arrays.
+     */
+    void getLinear(const SampleType* frequencies, coefficientsType* coefficients, std::size_t numSamples) const noexcept;
+
+    //==============================================================================
+    filterType getFilterType()  const noexcept { return type; }
+    SampleType getResonance()   const noexcept { return resonance; }
+    SampleType getGain()        const noexcept { return gain; }
+    double getSampleRate()      const noexcept { return sampleRate; }
+    int getSize()               const noexcept { return static_cast<int>(table.size()); }
+    /** Returns the memory used by the table points, in bytes. */
+    std::size_t getSizeInBytes() const noexcept { return table.size() * sizeof(coefficientsType); }
+
+private:
+    //==============================================================================
+    /** Returns the fractional table position of a frequency. */
+    SampleType getPosition(SampleType frequency) const noexcept;
+
+    const filterType type;
+    const SampleType resonance, gain;
+    const double sampleRate;
+
+    std::vector<coefficientsType> table;
+
+    SampleType minFrequency, maxFrequency, logMinFrequency, positionsPerLogHz;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiquadsCoefficientTable)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
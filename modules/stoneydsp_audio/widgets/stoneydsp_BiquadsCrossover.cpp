@@ -0,0 +1,335 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCrossover.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Linkwitz-Riley multiband crossover, with every band computed side by side from the same input.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+BiquadsCrossover<SampleType>::BiquadsCrossover()
+{
+    static_assert(static_cast<std::size_t>(maxBands) <= numLanes, "Every band needs a lane.");
+
+    // Spread evenly over the audio band until told otherwise.
+    constexpr SampleType defaultFrequencies[] = { 120.0, 1000.0, 4000.0, 8000.0, 12000.0 };
+
+    for (std::size_t i = 0; i < frequencies.size(); ++i)
+        frequencies[i] = defaultFrequencies[i];
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.sampleRate > 0);
+    jassert(spec.numChannels > 0);
+
+    sampleRate = spec.sampleRate;
+    state.resize(spec.numChannels);
+
+    // A job per channel, for the pool, made here once and reused.
+    channelJobs.clear();
+
+    for (std::size_t channel = 0; channel < static_cast<std::size_t>(spec.numChannels); ++channel)
+        channelJobs.push_back(std::make_unique<ChannelJob>(*this, channel));
+
+    reset();
+    design();
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::reset() noexcept
+{
+    for (auto& channelState : state)
+    {
+        for (auto& step : channelState.s1)
+            step.fill(static_cast<SampleType>(0.0));
+
+        for (auto& step : channelState.s2)
+            step.fill(static_cast<SampleType>(0.0));
+    }
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::setNumBands(int newNumBands) noexcept
+{
+    newNumBands = juce::jlimit(minBands, maxBands, newNumBands);
+
+    if (newNumBands == numBands)
+        return;
+
+    numBands = newNumBands;
+
+    reset();
+    design();
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::setCrossoverFrequency(int index, SampleType newFrequency) noexcept
+{
+    jassert(juce::isPositiveAndBelow(index, maxBands - 1));
+
+    auto& frequency = frequencies[static_cast<std::size_t>(juce::jlimit(0, maxBands - 2, index))];
+
+    if (newFrequency == frequency)
+        return;
+
+    // Only the coefficients move; the state carries on.
+    frequency = newFrequency;
+    design();
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::setSlope(int newSlope) noexcept
+{
+    jassert(newSlope == 24 || newSlope == 48);
+
+    newSlope = newSlope > 24 ? 48 : 24;
+
+    if (newSlope == slope)
+        return;
+
+    slope = newSlope;
+
+    reset();
+    design();
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::appendSection(std::size_t lane, const coefficientsType& section) noexcept
+{
+    auto& length = laneLength[lane];
+
+    jassert(length < maxChainLength);
+
+    auto& step = chain[length++];
+
+    step.b0[lane] = section.b0;
+    step.b1[lane] = section.b1;
+    step.b2[lane] = section.b2;
+    step.a1[lane] = section.a1;
+    step.a2[lane] = section.a2;
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::design() noexcept
+{
+    using cascadeType = BiquadsCascade<SampleType>;
+
+    constexpr auto one = StoneyDSP::Maths::Constants<SampleType>::one;
+    constexpr auto two = StoneyDSP::Maths::Constants<SampleType>::two;
+    constexpr auto pi  = juce::MathConstants<SampleType>::pi;
+
+    if (sampleRate <= 0.0)
+        return;
+
+    // Unused steps and lanes pass their input straight through.
+    for (auto& step : chain)
+    {
+        step.b0.fill(one);
+        step.b1.fill(static_cast<SampleType>(0.0));
+        step.b2.fill(static_cast<SampleType>(0.0));
+        step.a1.fill(static_cast<SampleType>(0.0));
+        step.a2.fill(static_cast<SampleType>(0.0));
+    }
+
+    laneLength.fill(0);
+
+    const auto numCrossovers = static_cast<std::size_t>(numBands - 1);
+    const auto maxFrequency = static_cast<SampleType>(sampleRate / 2.125);
+    const auto minFrequency = static_cast<SampleType>(sampleRate / 24576.0);
+
+    std::array<std::array<coefficientsType, cascadeType::maxSections>, maxBands - 1> lowPass, highPass, allPass;
+    int numSections = 0;
+
+    for (std::size_t crossover = 0; crossover < numCrossovers; ++crossover)
+    {
+        const auto frequency = frequencies[crossover];
+
+        numSections = cascadeType::calculateSections(BiquadsFilterType::lowPass2,  BiquadsCascadeResponse::linkwitzRiley, frequency, slope, sampleRate, lowPass[crossover].data());
+        cascadeType::calculateSections(BiquadsFilterType::highPass2, BiquadsCascadeResponse::linkwitzRiley, frequency, slope, sampleRate, highPass[crossover].data());
+
+        // Low-pass plus high-pass of an LR filter is the allpass with the
+        // poles of its Butterworth half: b = (a2, a1, 1), reversed.
+        const auto omega = juce::jlimit(minFrequency, maxFrequency, frequency) * ((pi * two) / static_cast<SampleType>(sampleRate));
+        const auto cos = std::cos(omega);
+        const auto sin = std::sin(omega);
+        const auto order = slope / 12;
+
+        for (int pole = 1; pole <= order / 2; ++pole)
+        {
+            const auto theta = static_cast<SampleType>(2 * pole - 1) * pi / static_cast<SampleType>(2 * order);
+            const auto alpha = sin * std::cos(theta);
+            const auto a0 = one + alpha;
+
+            auto& section = allPass[crossover][static_cast<std::size_t>(pole - 1)];
+
+            section.b0 = (one - alpha) / a0;
+            section.b1 = -(two * cos) / a0;
+            section.b2 = one;
+            section.a1 = (two * cos) / a0;
+            section.a2 = -(one - alpha) / a0;
+        }
+    }
+
+    const auto numAllPassSections = static_cast<std::size_t>(slope / 24);
+
+    for (std::size_t band = 0; band < static_cast<std::size_t>(numBands); ++band)
+    {
+        for (std::size_t crossover = 0; crossover < band; ++crossover)
+            for (int i = 0; i < numSections; ++i)
+                appendSection(band, highPass[crossover][static_cast<std::size_t>(i)]);
+
+        if (band < numCrossovers)
+            for (int i = 0; i < numSections; ++i)
+                appendSection(band, lowPass[band][static_cast<std::size_t>(i)]);
+
+        for (std::size_t crossover = band + 1; crossover < numCrossovers; ++crossover)
+            for (std::size_t i = 0; i < numAllPassSections; ++i)
+                appendSection(band, allPass[crossover][i]);
+    }
+
+    chainLength = *std::max_element(laneLength.begin(), laneLength.end());
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::processChannel(const SampleType* input, SampleType* const* outputs, std::size_t channel, std::size_t numSamples) noexcept
+{
+    jassert(channel < state.size());
+
+    // Work on local copies, so that the compiler knows nothing else can
+    // touch them and keeps the lanes in vector registers.
+    auto& channelState = state[channel];
+    auto s1 = channelState.s1;
+    auto s2 = channelState.s2;
+    const auto& steps = chain;
+    const auto length = chainLength;
+
+    std::array<SampleType, numLanes> x;
+
+    for (std::size_t n = 0; n < numSamples; ++n)
+    {
+        x.fill(input[n]);
+
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            const auto& step = steps[i];
+            auto& z1 = s1[i];
+            auto& z2 = s2[i];
+
+            std::array<SampleType, numLanes> y;
+
+            for (std::size_t lane = 0; lane < numLanes; ++lane)
+                y[lane] = (x[lane] * step.b0[lane]) + z1[lane];
+
+            for (std::size_t lane = 0; lane < numLanes; ++lane)
+                z1[lane] = (x[lane] * step.b1[lane]) + z2[lane] + (y[lane] * step.a1[lane]);
+
+            for (std::size_t lane = 0; lane < numLanes; ++lane)
+                z2[lane] = (x[lane] * step.b2[lane]) + (y[lane] * step.a2[lane]);
+
+            x = y;
+        }
+
+        for (std::size_t band = 0; band < static_cast<std::size_t>(numBands); ++band)
+            outputs[band][n] = x[band];
+    }
+
+    channelState.s1 = s1;
+    channelState.s2 = s2;
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::process(const juce::dsp::AudioBlock<const SampleType>& input, juce::dsp::AudioBlock<SampleType>* bandOutputs) noexcept
+{
+    jassert(bandOutputs != nullptr);
+
+    const auto numChannels = input.getNumChannels();
+    const auto numSamples = input.getNumSamples();
+
+    for (std::size_t channel = 0; channel < numChannels; ++channel)
+    {
+        std::array<SampleType*, maxBands> outputs {};
+
+        for (std::size_t band = 0; band < static_cast<std::size_t>(numBands); ++band)
+        {
+            jassert(bandOutputs[band].getNumChannels() == numChannels);
+            jassert(bandOutputs[band].getNumSamples() == numSamples);
+
+            outputs[band] = bandOutputs[band].getChannelPointer(channel);
+        }
+
+        processChannel(input.getChannelPointer(channel), outputs.data(), channel, numSamples);
+    }
+}
+
+template <typename SampleType>
+void BiquadsCrossover<SampleType>::process(const juce::dsp::AudioBlock<const SampleType>& input, juce::dsp::AudioBlock<SampleType>* bandOutputs, juce::ThreadPool& pool)
+{
+    jassert(bandOutputs != nullptr);
+
+    const auto numChannels = input.getNumChannels();
+    const auto numSamples = input.getNumSamples();
+
+    jassert(numChannels <= channelJobs.size());
+
+    // Channels share nothing but the coefficients, which stay put while the
+    // jobs run, so each can be split on its own thread.
+    for (std::size_t channel = 0; channel < numChannels; ++channel)
+    {
+        auto& job = *channelJobs[channel];
+
+        job.input = input.getChannelPointer(channel);
+        job.numSamples = numSamples;
+
+        for (std::size_t band = 0; band < static_cast<std::size_t>(numBands); ++band)
+            job.outputs[band] = bandOutputs[band].getChannelPointer(channel);
+
+        pool.addJob(&job, false);
+    }
+
+    // Each job is out of the pool again once it has been waited for, ready
+    // for the next block.
+    for (std::size_t channel = 0; channel < numChannels; ++channel)
+        pool.waitForJobToFinish(channelJobs[channel].get(), -1);
+}
+
+//==============================================================================
+template class BiquadsCrossover<float>;
+template class BiquadsCrossover<double>;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
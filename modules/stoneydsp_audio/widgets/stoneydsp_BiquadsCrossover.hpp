@@ -0,0 +1,191 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsCrossover.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Linkwitz-Riley multiband crossover, with every band computed side by side from the same input.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief Splits a signal into 2 to 6 bands with Linkwitz-Riley (LR4 or LR8)
+ * crossovers, writing each band to its own buffer. The bands sum back to the
+ * input, with a flat magnitude and the phase of an allpass.
+ *
+ * Each band's response is that of the usual split tree: band k is the
+ * high-pass of every crossover below it, the low-pass of the crossover above
+ * it, and the allpass of every crossover above that (which the lower bands
+ * need so that their phase matches the higher ones). Rather than walking the
+ * tree, every band is worked out directly from the same input, as a chain of
+ * ```BiquadsCascade``` sections padded to the length of the longest chain. The
+ * bands are the lanes: each step of the filter runs the same section of every
+ * band's chain at once, with the coefficients held as structure-of-arrays,
+ * which the compiler turns into SIMD operations across the bands.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class BiquadsCrossover
+{
+public:
+    using coefficientsType      = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
+
+    /** The fewest and the most bands. */
+    static constexpr int minBands = 2;
+    static constexpr int maxBands = 6;
+
+    /** The number of bands worked out side by side; at least ```maxBands```. */
+    static constexpr std::size_t numLanes = 8;
+
+    /** The longest chain of sections in any band: LR8, six bands. */
+    static constexpr std::size_t maxChainLength = 20;
+
+    //==============================================================================
+    /** Constructor. */
+    BiquadsCrossover();
+
+    //==============================================================================
+    /** Initialises the processor. */
+    void prepare(const juce::dsp::ProcessSpec& spec);
+
+    /** Resets the internal state variables of the processor. */
+    void reset() noexcept;
+
+    /**
+     * @brief Sets the number of bands, from ```minBands``` to ```maxBands```.
+     * Resets the crossover. Does not allocate.
+     */
+    void setNumBands(int newNumBands) noexcept;
+    int getNumBands() const noexcept { return numBands; }
+
+    /**
+     * @brief Sets the frequency of one crossover, between band ```index``` and
+     * band ```index + 1```. The crossover frequencies should rise with the
+     * index. Does not allocate.
+     */
+    void setCrossoverFrequency(int index, SampleType newFrequency) noexcept;
+    SampleType getCrossoverFrequency(int index) const noexcept { return frequencies[static_cast<std::size_t>(index)]; }
+
+    /**
+     * @brief Sets the slope of every crossover: 24 (LR4) or 48 (LR8)
+     * dB/octave. Resets the crossover. Does not allocate.
+     */
+    void setSlope(int newSlope) noexcept;
+    int getSlope() const noexcept { return slope; }
+
+    //==============================================================================
+    /**
+     * @brief Splits the input into the bands.
+     *
+     * @param input the signal to split.
+     * @param bandOutputs one block per band, each with the same number of
+     * channels and samples as the input; may not overlap the input.
+     */
+    void process(const juce::dsp::AudioBlock<const SampleType>& input, juce::dsp::AudioBlock<SampleType>* bandOutputs) noexcept;
+
+    /**
+     * @brief Splits the input as above, with each channel handed to a thread
+     * of the pool and waited for. The jobs are made in ```prepare()``` and
+     * reused, so this doesn't allocate, but the caller blocks: for offline
+     * renders of many channels only.
+     */
+    void process(const juce::dsp::AudioBlock<const SampleType>& input, juce::dsp::AudioBlock<SampleType>* bandOutputs, juce::ThreadPool& pool);
+
+private:
+    //==============================================================================
+    /** Designs every band's chain from the current settings. */
+    void design() noexcept;
+
+    /** Appends a section to one band's chain. */
+    void appendSection(std::size_t lane, const coefficientsType& section) noexcept;
+
+    void processChannel(const SampleType* input, SampleType* const* outputs, std::size_t channel, std::size_t numSamples) noexcept;
+
+    /** The coefficients of every band (lane) for each step of the chain. */
+    struct ChainStep
+    {
+        std::array<SampleType, numLanes> b0, b1, b2, a1, a2;
+    };
+
+    /** The state of every band (lane) for each step of the chain, for one channel. */
+    struct ChannelState
+    {
+        std::array<std::array<SampleType, numLanes>, maxChainLength> s1 {}, s2 {};
+    };
+
+    /** One channel of a block, for the pool; see ```process()```. */
+    class ChannelJob : public juce::ThreadPoolJob
+    {
+    public:
+        ChannelJob(BiquadsCrossover& owner, std::size_t channelIndex)
+        : juce::ThreadPoolJob("Biquads crossover channel")
+        , crossover(owner)
+        , channel(channelIndex)
+        {}
+
+        JobStatus runJob() override
+        {
+            juce::ScopedNoDenormals noDenormals;
+
+            crossover.processChannel(input, outputs.data(), channel, numSamples);
+            return jobHasFinished;
+        }
+
+        const SampleType* input = nullptr;
+        std::array<SampleType*, maxBands> outputs {};
+        std::size_t numSamples = 0;
+
+    private:
+        BiquadsCrossover& crossover;
+        const std::size_t channel;
+    };
+
+    std::array<ChainStep, maxChainLength> chain {};
+    std::array<std::size_t, numLanes> laneLength {};
+    std::size_t chainLength = 0;
+
+    std::vector<ChannelState> state;
+    std::vector<std::unique_ptr<ChannelJob>> channelJobs;
+
+    std::array<SampleType, maxBands - 1> frequencies {};
+    int numBands = 2;
+    int slope = 24;
+    double sampleRate = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiquadsCrossover)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
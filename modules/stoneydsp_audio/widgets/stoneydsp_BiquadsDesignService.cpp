@@ -0,0 +1,176 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsDesignService.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Designs Biquads coefficients on a background thread.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+BiquadsDesignService<SampleType>::BiquadsDesignService(std::size_t numberOfSlots)
+: juce::Thread("Biquads design service")
+, numSlots(numberOfSlots)
+, slots(std::make_unique<Slot[]>(numberOfSlots))
+{
+    jassert(numSlots > 0);
+
+    batchSlots          .resize(numSlots);
+    batchTypes          .resize(numSlots);
+    batchFrequencies    .resize(numSlots);
+    batchResonances     .resize(numSlots);
+    batchGains          .resize(numSlots);
+    batchCoefficients   .resize(numSlots);
+}
+
+template <typename SampleType>
+BiquadsDesignService<SampleType>::~BiquadsDesignService()
+{
+    stop();
+}
+
+template <typename SampleType>
+void BiquadsDesignService<SampleType>::start()
+{
+    startThread(juce::Thread::Priority::low);
+}
+
+template <typename SampleType>
+void BiquadsDesignService<SampleType>::stop()
+{
+    stopThread(1000);
+}
+
+template <typename SampleType>
+void BiquadsDesignService<SampleType>::clear() noexcept
+{
+    jassert(! isThreadRunning());
+
+    for (std::size_t slot = 0; slot < numSlots; ++slot)
+    {
+        slots[slot].requests.collect();
+        slots[slot].results.collect();
+    }
+
+    hasPendingRequests.store(false, std::memory_order_relaxed);
+}
+
+template <typename SampleType>
+void BiquadsDesignService<SampleType>::request(std::size_t slot, const Request& newRequest) noexcept
+{
+    jassert(slot < numSlots);
+
+    slots[slot].requests.post(newRequest);
+    hasPendingRequests.store(true, std::memory_order_release);
+}
+
+template <typename SampleType>
+const typename BiquadsDesignService<SampleType>::coefficientsType* BiquadsDesignService<SampleType>::collect(std::size_t slot) noexcept
+{
+    jassert(slot < numSlots);
+
+    return slots[slot].results.collect();
+}
+
+template <typename SampleType>
+void BiquadsDesignService<SampleType>::run()
+{
+    // The audio thread never signals us (that would mean taking a lock), so
+    // poll for requests instead, in the same way as juce::dsp::Convolution's
+    // background loader does.
+    while (! threadShouldExit())
+    {
+        if (hasPendingRequests.exchange(false, std::memory_order_acquire))
+        {
+            std::size_t batchSize = 0;
+            double batchSampleRate = 0.0;
+            auto batchMethod = designMethodType::bilinear;
+
+            for (std::size_t slot = 0; slot < numSlots; ++slot)
+            {
+                if (const auto* pending = slots[slot].requests.collect())
+                {
+                    // A batch shares one sample rate and design method.
+                    if (batchSize > 0 && (pending->sampleRate != batchSampleRate || pending->method != batchMethod))
+                    {
+                        designBatch(batchSize, batchSampleRate, batchMethod);
+                        batchSize = 0;
+                    }
+
+                    batchSampleRate                 = pending->sampleRate;
+                    batchMethod                     = pending->method;
+                    batchSlots          [batchSize] = slot;
+                    batchTypes          [batchSize] = pending->type;
+                    batchFrequencies    [batchSize] = pending->frequency;
+                    batchResonances     [batchSize] = pending->resonance;
+                    batchGains          [batchSize] = pending->gain;
+                    ++batchSize;
+                }
+            }
+
+            if (batchSize > 0)
+                designBatch(batchSize, batchSampleRate, batchMethod);
+
+            continue;
+        }
+
+        wait(pollIntervalMs);
+    }
+}
+
+template <typename SampleType>
+void BiquadsDesignService<SampleType>::designBatch(std::size_t batchSize, double sampleRate, designMethodType method) noexcept
+{
+    // The matched designs have no batched form; they are designed one by one.
+    if (method == designMethodType::matched)
+    {
+        for (std::size_t i = 0; i < batchSize; ++i)
+            batchCoefficients[i] = Biquads<SampleType>::calculateCoefficients(batchTypes[i], batchFrequencies[i], batchResonances[i], batchGains[i], sampleRate, method);
+    }
+    else
+    {
+        Biquads<SampleType>::calculateCoefficients(batchTypes.data(), batchFrequencies.data(), batchResonances.data(), batchGains.data(), batchCoefficients.data(), batchSize, sampleRate);
+    }
+
+    for (std::size_t i = 0; i < batchSize; ++i)
+        slots[batchSlots[i]].results.post(batchCoefficients[i]);
+}
+
+//==============================================================================
+template class BiquadsDesignService<float>;
+template class BiquadsDesignService<double>;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
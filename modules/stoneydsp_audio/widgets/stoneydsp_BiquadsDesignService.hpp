@@ -0,0 +1,145 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsDesignService.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Designs Biquads coefficients on a background thread.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief Designs ```Biquads``` coefficients on a background thread, so that
+ * the trigonometry and the per-type design never run on the audio thread.
+ *
+ * Each filter owns a numbered slot. The audio thread posts the settings it
+ * wants with ```request()``` and picks up finished coefficient sets with
+ * ```collect()```; both sides of each slot are lock-free mailboxes, so
+ * neither call blocks or allocates. Requests for a slot that arrive faster
+ * than they can be designed are coalesced into the latest one, and all the
+ * requests pending at once are designed together as one batch.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class BiquadsDesignService : private juce::Thread
+{
+public:
+    using filterType            = StoneyDSP::Audio::BiquadsFilterType;
+    using designMethodType      = StoneyDSP::Audio::BiquadsDesignMethod;
+    using coefficientsType      = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
+
+    /** The settings to design a filter from. */
+    struct Request
+    {
+        filterType  type        = filterType::peak;
+        SampleType  frequency   = static_cast<SampleType>(1000.0);
+        SampleType  resonance   = static_cast<SampleType>(0.5);
+        SampleType  gain        = static_cast<SampleType>(0.0);
+        double      sampleRate  = 44100.0;
+        designMethodType method = designMethodType::bilinear;
+    };
+
+    //==============================================================================
+    /**
+     * @brief Construct a new BiquadsDesignService object.
+     *
+     * @param numberOfSlots the number of filters served; all slots are
+     * allocated here.
+     */
+    explicit BiquadsDesignService(std::size_t numberOfSlots);
+    ~BiquadsDesignService() override;
+
+    //==============================================================================
+    /** Starts the background thread. Call from the message thread. */
+    void start();
+    /** Stops the background thread. Call from the message thread. */
+    void stop();
+    /**
+     * @brief Throws away every pending request and undelivered design, e.g.
+     * after the sample rate has changed. Only call this while stopped.
+     */
+    void clear() noexcept;
+
+    //==============================================================================
+    /**
+     * @brief Asks for a filter to be designed. Lock-free; call from one thread
+     * only (normally the audio thread).
+     */
+    void request(std::size_t slot, const Request& newRequest) noexcept;
+
+    /**
+     * @brief Picks up a finished design. Lock-free; call from one thread only
+     * (normally the audio thread).
+     *
+     * @return the new coefficients, valid until the next call for this slot,
+     * or ```nullptr``` if nothing new has been designed.
+     */
+    const coefficientsType* collect(std::size_t slot) noexcept;
+
+    /** Returns the number of slots. */
+    std::size_t getNumSlots() const noexcept { return numSlots; }
+
+private:
+    //==============================================================================
+    void run() override;
+
+    /** Designs the gathered requests in one batch and posts the results. */
+    void designBatch(std::size_t batchSize, double sampleRate, designMethodType method) noexcept;
+
+    struct Slot
+    {
+        StoneyDSP::Core::Mailbox<Request>           requests;
+        StoneyDSP::Core::Mailbox<coefficientsType>  results;
+    };
+
+    const std::size_t numSlots;
+    std::unique_ptr<Slot[]> slots;
+
+    /** Requests gathered for one batch, as structure-of-arrays. */
+    std::vector<std::size_t>        batchSlots;
+    std::vector<filterType>         batchTypes;
+    std::vector<SampleType>         batchFrequencies, batchResonances, batchGains;
+    std::vector<coefficientsType>   batchCoefficients;
+
+    std::atomic<bool> hasPendingRequests { false };
+
+    /** Poll interval of the background thread, in milliseconds. */
+    static constexpr int pollIntervalMs = 10;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiquadsDesignService)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
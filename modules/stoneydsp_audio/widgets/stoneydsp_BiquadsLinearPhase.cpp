@@ -0,0 +1,290 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsLinearPhase.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Linear-phase FIR equivalent of a set of Biquads sections, applied by partitioned FFT convolution.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+BiquadsLinearPhase<SampleType>::BiquadsLinearPhase(int headSizeInSamples)
+: juce::Thread("Biquads linear phase")
+, headSize(headSizeInSamples)
+{
+    jassert(headSize >= 0);
+}
+
+template <typename SampleType>
+BiquadsLinearPhase<SampleType>::~BiquadsLinearPhase()
+{
+    stopThread(1000);
+}
+
+template <typename SampleType>
+void BiquadsLinearPhase<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.sampleRate > 0);
+    jassert(spec.numChannels > 0);
+
+    stopThread(1000);
+
+    sampleRate = spec.sampleRate;
+    order = getOrderForSampleRate(sampleRate);
+
+    fft = std::make_unique<juce::dsp::FFT>(order);
+    workspace.assign(static_cast<std::size_t>(2 << order), 0.0f);
+
+    const auto numConvolutions = (spec.numChannels + 1) / 2;
+
+    convolutions.clear();
+
+    for (juce::uint32 i = 0; i < numConvolutions; ++i)
+    {
+        auto convolution = std::make_unique<juce::dsp::Convolution>(juce::dsp::Convolution::NonUniform { headSize }, convolutionQueue);
+        convolution->prepare({ spec.sampleRate, spec.maximumBlockSize, std::min(spec.numChannels - (i * 2), static_cast<juce::uint32>(2)) });
+        convolutions.push_back(std::move(convolution));
+    }
+
+    if (std::is_same<SampleType, double>::value)
+        floatBuffer.setSize(static_cast<int>(spec.numChannels), static_cast<int>(spec.maximumBlockSize));
+
+    // Whatever arrived while stopped is the newest request.
+    if (const auto* pending = requests.collect())
+        designedRequest = *pending;
+
+    hasPendingRequest.store(false, std::memory_order_relaxed);
+
+    loadKernel(designedRequest);
+
+    startThread(juce::Thread::Priority::low);
+}
+
+template <typename SampleType>
+void BiquadsLinearPhase<SampleType>::reset() noexcept
+{
+    for (auto& convolution : convolutions)
+        convolution->reset();
+}
+
+template <typename SampleType>
+void BiquadsLinearPhase<SampleType>::setSections(const coefficientsType* newSections, std::size_t numSections) noexcept
+{
+    jassert(numSections <= maxSections);
+
+    // Built in place in the mailbox's free buffer would be nicer, but posting
+    // a copy only happens when a parameter changes.
+    Request request;
+    request.numSections = std::min(numSections, maxSections);
+
+    std::copy(newSections, newSections + request.numSections, request.sections.begin());
+
+    requests.post(request);
+    hasPendingRequest.store(true, std::memory_order_release);
+}
+
+template <typename SampleType>
+void BiquadsLinearPhase<SampleType>::process(const juce::dsp::ProcessContextReplacing<SampleType>& context) noexcept
+{
+    auto& block = context.getOutputBlock();
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+
+    const auto convolve = [this](juce::dsp::AudioBlock<float>& floatBlock)
+    {
+        const auto numFloatChannels = floatBlock.getNumChannels();
+
+        for (std::size_t i = 0; i < convolutions.size() && i * 2 < numFloatChannels; ++i)
+        {
+            auto pairBlock = floatBlock.getSubsetChannelBlock(i * 2, std::min(numFloatChannels - (i * 2), static_cast<std::size_t>(2)));
+            convolutions[i]->process(juce::dsp::ProcessContextReplacing<float>(pairBlock));
+        }
+    };
+
+    if constexpr (std::is_same<SampleType, float>::value)
+    {
+        convolve(block);
+    }
+    else
+    {
+        jassert(numChannels <= static_cast<std::size_t>(floatBuffer.getNumChannels()));
+        jassert(numSamples <= static_cast<std::size_t>(floatBuffer.getNumSamples()));
+
+        // The convolution only runs in single precision.
+        auto floatBlock = juce::dsp::AudioBlock<float>(floatBuffer).getSubsetChannelBlock(0, numChannels).getSubBlock(0, numSamples);
+
+        for (std::size_t channel = 0; channel < numChannels; ++channel)
+        {
+            const auto* source = block.getChannelPointer(channel);
+            auto* destination = floatBlock.getChannelPointer(channel);
+
+            for (std::size_t i = 0; i < numSamples; ++i)
+                destination[i] = static_cast<float>(source[i]);
+        }
+
+        convolve(floatBlock);
+
+        for (std::size_t channel = 0; channel < numChannels; ++channel)
+        {
+            const auto* source = floatBlock.getChannelPointer(channel);
+            auto* destination = block.getChannelPointer(channel);
+
+            for (std::size_t i = 0; i < numSamples; ++i)
+                destination[i] = static_cast<SampleType>(source[i]);
+        }
+    }
+}
+
+template <typename SampleType>
+int BiquadsLinearPhase<SampleType>::getLatencySamples() const noexcept
+{
+    const auto convolutionLatency = convolutions.empty() ? 0 : convolutions.front()->getLatency();
+
+    return getKernelSize() / 2 + convolutionLatency;
+}
+
+template <typename SampleType>
+int BiquadsLinearPhase<SampleType>::getOrderForSampleRate(double newSampleRate) noexcept
+{
+    // About 170 ms: enough to resolve a band in the bottom octave.
+    const auto length = newSampleRate * 0.17;
+
+    return juce::jlimit(minOrder, maxOrder, static_cast<int>(std::round(std::log2(std::max(length, 1.0)))));
+}
+
+template <typename SampleType>
+void BiquadsLinearPhase<SampleType>::designKernel(const coefficientsType* sections, std::size_t numSections, const juce::dsp::FFT& fft, float* workspace, float* kernel) noexcept
+{
+    constexpr auto twoPi = juce::MathConstants<double>::twoPi;
+
+    const auto size = static_cast<std::size_t>(fft.getSize());
+
+    std::fill(workspace, workspace + (size * 2), 0.0f);
+
+    // The magnitude of every section at each bin, times the phase of a delay
+    // of size / 2, i.e. (-1)^bin. The stored a1 and a2 are negated, so the
+    // denominator is 1 - a1 z^-1 - a2 z^-2.
+    for (std::size_t bin = 0; bin <= size / 2; ++bin)
+    {
+        const auto omega = twoPi * static_cast<double>(bin) / static_cast<double>(size);
+        const auto cos1 = std::cos(omega), sin1 = std::sin(omega);
+        const auto cos2 = std::cos(omega * 2.0), sin2 = std::sin(omega * 2.0);
+
+        auto magnitude = 1.0;
+
+        for (std::size_t i = 0; i < numSections; ++i)
+        {
+            const auto& section = sections[i];
+
+            const auto b0 = static_cast<double>(section.b0), b1 = static_cast<double>(section.b1), b2 = static_cast<double>(section.b2);
+            const auto a1 = static_cast<double>(section.a1), a2 = static_cast<double>(section.a2);
+
+            const auto numRe = b0 + (b1 * cos1) + (b2 * cos2);
+            const auto numIm = -(b1 * sin1) - (b2 * sin2);
+            const auto denRe = 1.0 - (a1 * cos1) - (a2 * cos2);
+            const auto denIm = (a1 * sin1) + (a2 * sin2);
+
+            magnitude *= std::sqrt(((numRe * numRe) + (numIm * numIm)) / ((denRe * denRe) + (denIm * denIm)));
+        }
+
+        workspace[bin * 2] = static_cast<float>((bin & 1) != 0 ? -magnitude : magnitude);
+    }
+
+    fft.performRealOnlyInverseTransform(workspace);
+
+    // A periodic Blackman window keeps the kernel symmetric about size / 2,
+    // so that the phase stays exactly linear.
+    for (std::size_t n = 0; n < size; ++n)
+    {
+        const auto phase = twoPi * static_cast<double>(n) / static_cast<double>(size);
+        const auto window = 0.42 - (0.5 * std::cos(phase)) + (0.08 * std::cos(phase * 2.0));
+
+        kernel[n] = static_cast<float>(static_cast<double>(workspace[n]) * window);
+    }
+}
+
+template <typename SampleType>
+void BiquadsLinearPhase<SampleType>::loadKernel(const Request& request)
+{
+    const auto size = getKernelSize();
+
+    juce::AudioBuffer<float> kernel(1, size);
+
+    designKernel(request.sections.data(), request.numSections, *fft, workspace.data(), kernel.getWritePointer(0));
+
+    for (std::size_t i = 0; i < convolutions.size(); ++i)
+    {
+        // Every convolution takes its own copy; the last can have the original.
+        juce::AudioBuffer<float> copy;
+
+        if (i + 1 < convolutions.size())
+            copy.makeCopyOf(kernel);
+        else
+            copy = std::move(kernel);
+
+        convolutions[i]->loadImpulseResponse(std::move(copy), sampleRate,
+                                             juce::dsp::Convolution::Stereo::no,
+                                             juce::dsp::Convolution::Trim::no,
+                                             juce::dsp::Convolution::Normalise::no);
+    }
+}
+
+template <typename SampleType>
+void BiquadsLinearPhase<SampleType>::run()
+{
+    // Polled, as in BiquadsDesignService; the audio thread never signals.
+    while (! threadShouldExit())
+    {
+        if (hasPendingRequest.exchange(false, std::memory_order_acquire))
+        {
+            if (const auto* pending = requests.collect())
+            {
+                designedRequest = *pending;
+                loadKernel(designedRequest);
+            }
+
+            continue;
+        }
+
+        wait(pollIntervalMs);
+    }
+}
+
+//==============================================================================
+template class BiquadsLinearPhase<float>;
+template class BiquadsLinearPhase<double>;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
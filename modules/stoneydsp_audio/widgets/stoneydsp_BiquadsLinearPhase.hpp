@@ -0,0 +1,174 @@
+/***************************************************************************//**
+ * @file stoneydsp_BiquadsLinearPhase.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Linear-phase FIR equivalent of a set of Biquads sections, applied by partitioned FFT convolution.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief Filters with the magnitude response of a set of ```Biquads```
+ * sections, but with linear phase.
+ *
+ * The combined magnitude of the sections is sampled on an FFT grid, given the
+ * phase of a pure delay of half the kernel, transformed back and windowed,
+ * giving a symmetric FIR kernel. That kernel is run by
+ * ```juce::dsp::Convolution```, uniformly partitioned or, given a head size,
+ * non-uniformly partitioned.
+ *
+ * Kernels are designed on a background thread. The audio thread posts new
+ * sections with ```setSections()``` (lock-free, no allocation), and the
+ * convolution crossfades from the old kernel to the new one once it arrives.
+ * The kernel is about 170 ms long at any sample rate, and its latency is
+ * half of that; see ```getLatencySamples()```.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class BiquadsLinearPhase : private juce::Thread
+{
+public:
+    using coefficientsType      = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
+
+    /** The most sections that can be combined into one kernel. */
+    static constexpr std::size_t maxSections = 256;
+
+    /** The shortest and longest kernels, as powers of two. */
+    static constexpr int minOrder = 12;
+    static constexpr int maxOrder = 16;
+
+    /** The most latency, at any sample rate, for sizing delay lines. */
+    static constexpr int maxLatencySamples = (1 << maxOrder) / 2;
+
+    //==============================================================================
+    /**
+     * @brief Constructor.
+     *
+     * @param headSizeInSamples the size of the first partition, for
+     * non-uniformly partitioned convolution; 0 partitions uniformly, by the
+     * block size.
+     */
+    explicit BiquadsLinearPhase(int headSizeInSamples = 0);
+    ~BiquadsLinearPhase() override;
+
+    //==============================================================================
+    /**
+     * @brief Initialises the processor, picks the kernel length for the
+     * sample rate and designs a first kernel from the last sections posted.
+     * Call from the message thread.
+     */
+    void prepare(const juce::dsp::ProcessSpec& spec);
+
+    /** Resets the internal state variables of the processor. */
+    void reset() noexcept;
+
+    /**
+     * @brief Asks for a kernel for these sections, to be crossfaded in once
+     * it has been designed. Lock-free; call from one thread only (normally
+     * the audio thread).
+     */
+    void setSections(const coefficientsType* newSections, std::size_t numSections) noexcept;
+
+    //==============================================================================
+    /** Processes the input and output samples supplied in the processing context. */
+    void process(const juce::dsp::ProcessContextReplacing<SampleType>& context) noexcept;
+
+    /**
+     * @brief Returns the latency of the filter, in samples: half the kernel,
+     * plus any latency of the convolution itself.
+     */
+    int getLatencySamples() const noexcept;
+
+    /** Returns the length of the kernel, in samples. */
+    int getKernelSize() const noexcept { return 1 << order; }
+
+    /** Returns the kernel order (power of two) used at a sample rate. */
+    static int getOrderForSampleRate(double sampleRate) noexcept;
+
+    /**
+     * @brief Designs a linear-phase kernel from some sections.
+     *
+     * @param fft an FFT of the kernel's order.
+     * @param workspace scratch space of twice the kernel's size.
+     * @param kernel receives the kernel, ```fft.getSize()``` samples long.
+     */
+    static void designKernel(const coefficientsType* sections, std::size_t numSections, const juce::dsp::FFT& fft, float* workspace, float* kernel) noexcept;
+
+private:
+    //==============================================================================
+    struct Request
+    {
+        std::array<coefficientsType, maxSections> sections {};
+        std::size_t numSections = 0;
+    };
+
+    void run() override;
+
+    /** Designs a kernel for the request and hands it to every convolution. */
+    void loadKernel(const Request& request);
+
+    /**
+     * ```juce::dsp::Convolution``` runs two channels at most, so there is one
+     * for each pair of channels, all loading through the same queue.
+     */
+    juce::dsp::ConvolutionMessageQueue convolutionQueue;
+    std::vector<std::unique_ptr<juce::dsp::Convolution>> convolutions;
+    const int headSize;
+
+    StoneyDSP::Core::Mailbox<Request> requests;
+    std::atomic<bool> hasPendingRequest { false };
+
+    /** The last request designed, so that a new sample rate can re-design it. */
+    Request designedRequest;
+
+    /** Owned by whichever thread is designing. */
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float> workspace;
+
+    /** Single-precision copy of the block, when ```SampleType``` is double. */
+    juce::AudioBuffer<float> floatBuffer;
+
+    int order = minOrder;
+    double sampleRate = 0.0;
+
+    /** Poll interval of the background thread, in milliseconds. */
+    static constexpr int pollIntervalMs = 10;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiquadsLinearPhase)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
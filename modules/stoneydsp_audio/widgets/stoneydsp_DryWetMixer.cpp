@@ -0,0 +1,293 @@
+/***************************************************************************//**
+ * @file stoneydsp_DryWetMixer.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Dry/wet mixer with a latency-compensated dry path, kept in an arena.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+DryWetMixer<SampleType>::DryWetMixer(int maximumWetLatencyInSamples)
+: maximumWetLatency(std::max(0, maximumWetLatencyInSamples))
+{
+}
+
+template <typename SampleType>
+std::size_t DryWetMixer<SampleType>::getArenaSize(const juce::dsp::ProcessSpec& spec) const noexcept
+{
+    const auto delayLength = static_cast<std::size_t>(maximumWetLatency) + 1;
+    const auto wetDelayLength = maximumWetDelay > 0 ? static_cast<std::size_t>(maximumWetDelay) + 1 : 0;
+
+    return StoneyDSP::Core::Arena::getSizeFor<SampleType>(spec.numChannels * delayLength)
+         + StoneyDSP::Core::Arena::getSizeFor<SampleType>(spec.numChannels * spec.maximumBlockSize)
+         + StoneyDSP::Core::Arena::getSizeFor<SampleType>(spec.numChannels * wetDelayLength);
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::prepare(const juce::dsp::ProcessSpec& spec, StoneyDSP::Core::Arena& arena)
+{
+    jassert(spec.sampleRate > 0);
+    jassert(spec.numChannels > 0);
+
+    sampleRate = spec.sampleRate;
+    numChannels = spec.numChannels;
+    maximumBlockSize = spec.maximumBlockSize;
+    delaySize = static_cast<std::size_t>(maximumWetLatency) + 1;
+    wetDelaySize = static_cast<std::size_t>(maximumWetDelay) + 1;
+
+    delay = arena.allocateArray<SampleType>(numChannels * delaySize);
+    dry = arena.allocateArray<SampleType>(numChannels * maximumBlockSize);
+    wetDelayLine = maximumWetDelay > 0 ? arena.allocateArray<SampleType>(numChannels * wetDelaySize)
+                                       : StoneyDSP::Core::ArenaArray<SampleType>();
+
+    // The arena was prepared without room for the mixer; see getArenaSize().
+    jassert(delay.size() == numChannels * delaySize && dry.size() == numChannels * maximumBlockSize);
+    jassert(maximumWetDelay == 0 || wetDelayLine.size() == numChannels * wetDelaySize);
+
+    if (delay.size() == 0 || dry.size() == 0)
+        numChannels = 0;
+
+    if (wetDelayLine.size() == 0)
+        wetDelaySize = 1;
+
+    wetDelay = std::min(wetDelay, static_cast<int>(wetDelaySize) - 1);
+
+    dryVolume.reset(sampleRate, 0.05);
+    wetVolume.reset(sampleRate, 0.05);
+
+    reset();
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::reset() noexcept
+{
+    std::fill(delay.begin(), delay.end(), static_cast<SampleType>(0.0));
+    std::fill(dry.begin(), dry.end(), static_cast<SampleType>(0.0));
+    std::fill(wetDelayLine.begin(), wetDelayLine.end(), static_cast<SampleType>(0.0));
+
+    writePosition = 0;
+    numDrySamples = 0;
+    wetWritePosition = 0;
+
+    dryVolume.setCurrentAndTargetValue(static_cast<SampleType>(1.0) - mix);
+    wetVolume.setCurrentAndTargetValue(mix);
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::setWetMixProportion(SampleType newWetMixProportion) noexcept
+{
+    jassert(juce::isPositiveAndNotGreaterThan(newWetMixProportion, static_cast<SampleType>(1.0)));
+
+    mix = juce::jlimit(static_cast<SampleType>(0.0), static_cast<SampleType>(1.0), newWetMixProportion);
+
+    dryVolume.setTargetValue(static_cast<SampleType>(1.0) - mix);
+    wetVolume.setTargetValue(mix);
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::setWetLatency(int newWetLatencyInSamples) noexcept
+{
+    jassert(newWetLatencyInSamples >= 0 && newWetLatencyInSamples <= maximumWetLatency);
+
+    wetLatency = juce::jlimit(0, maximumWetLatency, newWetLatencyInSamples);
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::setMaximumWetDelay(int maximumWetDelayInSamples) noexcept
+{
+    maximumWetDelay = std::max(0, maximumWetDelayInSamples);
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::setWetDelay(int newWetDelayInSamples) noexcept
+{
+    jassert(newWetDelayInSamples >= 0 && newWetDelayInSamples < static_cast<int>(wetDelaySize));
+
+    const auto newWetDelay = juce::jlimit(0, static_cast<int>(wetDelaySize) - 1, newWetDelayInSamples);
+
+    if (newWetDelay == wetDelay)
+        return;
+
+    wetDelay = newWetDelay;
+    wetWritePosition = 0;
+    std::fill(wetDelayLine.begin(), wetDelayLine.end(), static_cast<SampleType>(0.0));
+}
+
+template <typename SampleType>
+bool DryWetMixer<SampleType>::isSmoothing() const noexcept
+{
+    return dryVolume.isSmoothing() || wetVolume.isSmoothing();
+}
+
+template <typename SampleType>
+template <typename OtherSampleType>
+void DryWetMixer<SampleType>::copyStateFrom(const DryWetMixer<OtherSampleType>& other) noexcept
+{
+    jassert(other.delay.size() == delay.size() && other.wetDelayLine.size() == wetDelayLine.size());
+
+    if (other.delay.size() != delay.size() || other.wetDelayLine.size() != wetDelayLine.size())
+        return;
+
+    std::transform(other.delay.begin(), other.delay.end(), delay.begin(), [](OtherSampleType x) { return static_cast<SampleType>(x); });
+    std::transform(other.wetDelayLine.begin(), other.wetDelayLine.end(), wetDelayLine.begin(), [](OtherSampleType x) { return static_cast<SampleType>(x); });
+
+    writePosition = other.writePosition;
+    wetWritePosition = other.wetWritePosition;
+    wetLatency = other.wetLatency;
+    wetDelay = other.wetDelay;
+
+    mix = static_cast<SampleType>(other.mix);
+    dryVolume.setCurrentAndTargetValue(static_cast<SampleType>(other.dryVolume.getCurrentValue()));
+    wetVolume.setCurrentAndTargetValue(static_cast<SampleType>(other.wetVolume.getCurrentValue()));
+    dryVolume.setTargetValue(static_cast<SampleType>(1.0) - mix);
+    wetVolume.setTargetValue(mix);
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::pushDrySamples(const juce::dsp::AudioBlock<const SampleType> drySamples) noexcept
+{
+    jassert(drySamples.getNumChannels() <= numChannels);
+    jassert(drySamples.getNumSamples() <= maximumBlockSize);
+
+    const auto channels = std::min(drySamples.getNumChannels(), numChannels);
+    numDrySamples = std::min(drySamples.getNumSamples(), maximumBlockSize);
+
+    // Each channel's delay is written, then read wetLatency samples back; a
+    // latency of zero reads straight back what was just written.
+    const auto readOffset = delaySize - static_cast<std::size_t>(wetLatency);
+
+    for (std::size_t channel = 0; channel < channels; ++channel)
+    {
+        const auto* input = drySamples.getChannelPointer(channel);
+        auto* line = delay.data() + (channel * delaySize);
+        auto* output = dry.data() + (channel * maximumBlockSize);
+
+        auto write = writePosition;
+        auto read = (writePosition + readOffset) % delaySize;
+
+        for (std::size_t i = 0; i < numDrySamples; ++i)
+        {
+            line[write] = input[i];
+            output[i] = line[read];
+
+            if (++write == delaySize)
+                write = 0;
+
+            if (++read == delaySize)
+                read = 0;
+        }
+    }
+
+    writePosition = (writePosition + numDrySamples) % delaySize;
+}
+
+template <typename SampleType>
+void DryWetMixer<SampleType>::mixWetSamples(juce::dsp::AudioBlock<SampleType> wetSamples) noexcept
+{
+    jassert(wetSamples.getNumSamples() == numDrySamples);
+
+    const auto channels = std::min(wetSamples.getNumChannels(), numChannels);
+    const auto numSamples = std::min(wetSamples.getNumSamples(), numDrySamples);
+
+    // The wet delay runs just like the dry one, in place.
+    if (wetDelay > 0)
+    {
+        const auto readOffset = wetDelaySize - static_cast<std::size_t>(wetDelay);
+
+        for (std::size_t channel = 0; channel < channels; ++channel)
+        {
+            auto* samples = wetSamples.getChannelPointer(channel);
+            auto* line = wetDelayLine.data() + (channel * wetDelaySize);
+
+            auto write = wetWritePosition;
+            auto read = (wetWritePosition + readOffset) % wetDelaySize;
+
+            for (std::size_t i = 0; i < numSamples; ++i)
+            {
+                line[write] = samples[i];
+                samples[i] = line[read];
+
+                if (++write == wetDelaySize)
+                    write = 0;
+
+                if (++read == wetDelaySize)
+                    read = 0;
+            }
+        }
+
+        wetWritePosition = (wetWritePosition + numSamples) % wetDelaySize;
+    }
+
+    // While the mix glides, both gains step once per sample for every channel.
+    if (dryVolume.isSmoothing() || wetVolume.isSmoothing())
+    {
+        for (std::size_t i = 0; i < numSamples; ++i)
+        {
+            const auto dryGain = dryVolume.getNextValue();
+            const auto wetGain = wetVolume.getNextValue();
+
+            for (std::size_t channel = 0; channel < channels; ++channel)
+            {
+                auto& sample = wetSamples.getChannelPointer(channel)[i];
+                sample = (sample * wetGain) + (dry[(channel * maximumBlockSize) + i] * dryGain);
+            }
+        }
+
+        return;
+    }
+
+    const auto dryGain = dryVolume.getTargetValue();
+    const auto wetGain = wetVolume.getTargetValue();
+
+    for (std::size_t channel = 0; channel < channels; ++channel)
+    {
+        auto* output = wetSamples.getChannelPointer(channel);
+        const auto* input = dry.data() + (channel * maximumBlockSize);
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+            output[i] = (output[i] * wetGain) + (input[i] * dryGain);
+    }
+}
+
+//==============================================================================
+template class DryWetMixer<float>;
+template class DryWetMixer<double>;
+
+template void DryWetMixer<float>::copyStateFrom<double>(const DryWetMixer<double>&) noexcept;
+template void DryWetMixer<double>::copyStateFrom<float>(const DryWetMixer<float>&) noexcept;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
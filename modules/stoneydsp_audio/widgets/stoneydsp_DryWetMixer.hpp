@@ -0,0 +1,196 @@
+/***************************************************************************//**
+ * @file stoneydsp_DryWetMixer.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Dry/wet mixer with a latency-compensated dry path, kept in an arena.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief Mixes a dry signal back in with the wet one, delaying the dry signal
+ * by the latency of the wet path, as ```juce::dsp::DryWetMixer``` does with
+ * its linear mixing rule.
+ *
+ * The dry delay and the copy of the dry block are carved from an arena in
+ * ```prepare()``` rather than held in buffers of the mixer's own, so that
+ * they can sit alongside the rest of a processor's state; nothing is
+ * allocated after that.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class DryWetMixer
+{
+public:
+    //==============================================================================
+    /**
+     * @brief Constructor.
+     * @param maximumWetLatencyInSamples the most that ```setWetLatency()```
+     * will be asked for.
+     */
+    explicit DryWetMixer(int maximumWetLatencyInSamples = 0);
+
+    //==============================================================================
+    /** Returns the room that ```prepare()``` takes from an arena, in bytes. */
+    std::size_t getArenaSize(const juce::dsp::ProcessSpec& spec) const noexcept;
+
+    /**
+     * @brief Initialises the mixer, with its buffers carved from an arena
+     * that was prepared with room for at least ```getArenaSize()```. Does
+     * not allocate.
+     */
+    void prepare(const juce::dsp::ProcessSpec& spec, StoneyDSP::Core::Arena& arena);
+
+    /** Clears the dry delay, and jumps to the current mix. */
+    void reset() noexcept;
+
+    //==============================================================================
+    /**
+     * @brief Sets the amount of wet signal, from 0 (all dry) to 1 (all wet).
+     * Changes glide over 50ms.
+     */
+    void setWetMixProportion(SampleType newWetMixProportion) noexcept;
+
+    /** Sets the latency of the wet path, by which the dry signal is delayed. */
+    void setWetLatency(int newWetLatencyInSamples) noexcept;
+
+    /**
+     * @brief Sets the most that ```setWetDelay()``` will be asked for. Call
+     * before ```getArenaSize()``` and ```prepare()```.
+     */
+    void setMaximumWetDelay(int maximumWetDelayInSamples) noexcept;
+
+    /**
+     * @brief Delays the wet signal too, so that a wet path that has become
+     * shorter can keep the latency it had. The wet delay starts again from
+     * silence whenever it changes, so change it while the wet signal is mixed
+     * out.
+     */
+    void setWetDelay(int newWetDelayInSamples) noexcept;
+
+    /** Returns true while the mix is still gliding to its last setting. */
+    bool isSmoothing() const noexcept;
+
+    /**
+     * @brief Takes over the delays and the mix of a mixer of the other
+     * precision, prepared with the same spec and limits. Does not allocate.
+     */
+    template <typename OtherSampleType>
+    void copyStateFrom(const DryWetMixer<OtherSampleType>& other) noexcept;
+
+    //==============================================================================
+    /** Takes a copy of the dry block, before it is processed. */
+    void pushDrySamples(const juce::dsp::AudioBlock<const SampleType> drySamples) noexcept;
+
+    /** Mixes the dry block from the last ```pushDrySamples()``` into the wet one. */
+    void mixWetSamples(juce::dsp::AudioBlock<SampleType> wetSamples) noexcept;
+
+    /**
+     * @brief Returns true if ```processInPlace()``` can stand in for a push
+     * and a mix: there is no latency or wet delay, and the mix isn't gliding.
+     */
+    bool canProcessInPlace() const noexcept
+    {
+        return wetLatency == 0 && wetDelay == 0 && ! isSmoothing();
+    }
+
+    /**
+     * @brief Pushes, filters and mixes the channels in one pass, sample by
+     * sample, as ```pushDrySamples()```, a filter and ```mixWetSamples()```
+     * would block by block; only while ```canProcessInPlace()```.
+     *
+     * @param filter called with the channel index and each dry sample, in
+     * order, and returns the wet sample.
+     */
+    template <typename Filter>
+    void processInPlace(SampleType* const* channels, std::size_t numChannelsToProcess, std::size_t numSamples, Filter&& filter) noexcept
+    {
+        jassert(canProcessInPlace());
+        jassert(numChannelsToProcess <= numChannels);
+
+        const auto channelsToProcess = std::min(numChannelsToProcess, numChannels);
+        const auto dryGain = dryVolume.getTargetValue();
+        const auto wetGain = wetVolume.getTargetValue();
+
+        for (std::size_t channel = 0; channel < channelsToProcess; ++channel)
+        {
+            auto* samples = channels[channel];
+            auto* line = delay.data() + (channel * delaySize);
+            auto write = writePosition;
+
+            for (std::size_t i = 0; i < numSamples; ++i)
+            {
+                const auto drySample = samples[i];
+
+                // The dry delay still sees every sample, for when the
+                // latency next grows.
+                line[write] = drySample;
+
+                if (++write == delaySize)
+                    write = 0;
+
+                samples[i] = (filter(channel, drySample) * wetGain) + (drySample * dryGain);
+            }
+        }
+
+        writePosition = (writePosition + numSamples) % delaySize;
+    }
+
+private:
+    //==============================================================================
+    /** The dry delay, and the dry block that it last gave out, per channel. */
+    StoneyDSP::Core::ArenaArray<SampleType> delay, dry;
+
+    /** The wet delay, per channel; only carved when it can be used. */
+    StoneyDSP::Core::ArenaArray<SampleType> wetDelayLine;
+
+    std::size_t numChannels = 0, maximumBlockSize = 0, delaySize = 1, wetDelaySize = 1;
+    std::size_t writePosition = 0, numDrySamples = 0, wetWritePosition = 0;
+
+    int maximumWetLatency = 0, wetLatency = 0;
+    int maximumWetDelay = 0, wetDelay = 0;
+
+    juce::SmoothedValue<SampleType> dryVolume, wetVolume;
+    SampleType mix = static_cast<SampleType>(1.0);
+    double sampleRate = 0.0;
+
+    template <typename> friend class DryWetMixer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DryWetMixer)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,104 @@
+/***************************************************************************//**
+ * @file stoneydsp_QualityGovernor.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Steps quality down, and back up, to keep a processor within its deadline.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+void QualityGovernor::prepare(double newSampleRate) noexcept
+{
+    jassert(newSampleRate > 0.0);
+
+    sampleRate = newSampleRate;
+
+    reset();
+}
+
+void QualityGovernor::reset() noexcept
+{
+    averageLoad = 0.0;
+    timeSinceChange = 0.0;
+    timeBelowStepUpLoad = 0.0;
+
+    tier.store(0, std::memory_order_relaxed);
+    load.store(0.0f, std::memory_order_relaxed);
+}
+
+void QualityGovernor::setNumTiers(int newNumTiers) noexcept
+{
+    numTiers = std::max(0, newNumTiers);
+
+    if (getTier() > numTiers)
+        tier.store(numTiers, std::memory_order_relaxed);
+}
+
+void QualityGovernor::update(double elapsedSeconds, int numSamples) noexcept
+{
+    if (sampleRate <= 0.0 || numSamples <= 0)
+        return;
+
+    const auto deadline = static_cast<double>(numSamples) / sampleRate;
+
+    // Averaged over audio time rather than over blocks, so that it reacts as
+    // quickly at any block size.
+    averageLoad += (elapsedSeconds / deadline - averageLoad) * (1.0 - std::exp(-deadline / averagingTime));
+    load.store(static_cast<float>(averageLoad), std::memory_order_relaxed);
+
+    timeSinceChange += deadline;
+    timeBelowStepUpLoad = averageLoad < stepUpLoad ? timeBelowStepUpLoad + deadline : 0.0;
+
+    // Each change waits for the last one to show in the average; going back
+    // up also waits for the load to have stayed well clear of going down.
+    if (timeSinceChange < settleTime)
+        return;
+
+    auto newTier = getTier();
+
+    if (averageLoad > stepDownLoad && newTier < numTiers)
+        ++newTier;
+    else if (timeBelowStepUpLoad >= holdTime && newTier > 0)
+        --newTier;
+    else
+        return;
+
+    tier.store(newTier, std::memory_order_relaxed);
+    timeSinceChange = 0.0;
+    timeBelowStepUpLoad = 0.0;
+}
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,117 @@
+/***************************************************************************//**
+ * @file stoneydsp_QualityGovernor.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Steps quality down, and back up, to keep a processor within its deadline.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief Watches how long a processor takes over each block against the
+ * block's deadline (its length in seconds), and picks a quality tier from 0
+ * (full quality) up to ```getNumTiers()``` to suit: one tier down whenever
+ * the load stays high, and one back up only once it has stayed low for a
+ * while. What each tier means is up to the processor.
+ *
+ * ```update()``` is called from the audio thread only; the tier and the load
+ * can be read from any thread, for monitoring.
+ */
+class QualityGovernor
+{
+public:
+    //==============================================================================
+    /** The load (time taken over the deadline) above which a tier is dropped. */
+    static constexpr double stepDownLoad = 0.75;
+
+    /** The load that must be held below for ```holdTime``` to go back up. */
+    static constexpr double stepUpLoad = 0.35;
+
+    /** How long, in seconds, the load must stay low before a tier is regained. */
+    static constexpr double holdTime = 2.0;
+
+    /** How long, in seconds, to wait after any change before the next. */
+    static constexpr double settleTime = 0.25;
+
+    /** The time constant, in seconds, over which the load is averaged. */
+    static constexpr double averagingTime = 0.1;
+
+    //==============================================================================
+    QualityGovernor() = default;
+
+    /** Sets the sample rate that block lengths are measured at, and resets. */
+    void prepare(double newSampleRate) noexcept;
+
+    /** Goes back to full quality and forgets the load measured so far. */
+    void reset() noexcept;
+
+    //==============================================================================
+    /**
+     * @brief Sets the number of tiers below full quality. The current tier is
+     * brought back within range at once if it is outside it.
+     */
+    void setNumTiers(int newNumTiers) noexcept;
+
+    int getNumTiers() const noexcept { return numTiers; }
+
+    //==============================================================================
+    /**
+     * @brief Takes the time that the last block of ```numSamples``` took to
+     * process, and moves the tier if the load calls for it.
+     */
+    void update(double elapsedSeconds, int numSamples) noexcept;
+
+    /** Returns the current tier, from 0 (full quality) to ```getNumTiers()```. */
+    int getTier() const noexcept { return tier.load(std::memory_order_relaxed); }
+
+    /** Returns the averaged load, where 1 is the whole of the deadline. */
+    float getLoad() const noexcept { return load.load(std::memory_order_relaxed); }
+
+private:
+    //==============================================================================
+    double sampleRate = 0.0;
+    double averageLoad = 0.0;
+    double timeSinceChange = 0.0;
+    double timeBelowStepUpLoad = 0.0;
+    int numTiers = 0;
+
+    std::atomic<int> tier { 0 };
+    std::atomic<float> load { 0.0f };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(QualityGovernor)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,117 @@
+/***************************************************************************//**
+ * @file stoneydsp_Reblocker.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Splits, or gathers, host blocks into fixed-size internal blocks.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+template <typename SampleType>
+std::size_t Reblocker<SampleType>::getChannelStride(std::size_t blockSize) noexcept
+{
+    constexpr auto samplesPerAlignment = alignment / sizeof(SampleType);
+
+    return ((blockSize + samplesPerAlignment - 1) / samplesPerAlignment) * samplesPerAlignment;
+}
+
+template <typename SampleType>
+std::size_t Reblocker<SampleType>::getArenaSize(std::size_t numChannels, std::size_t blockSize, bool isFixedLatency) noexcept
+{
+    if (blockSize == 0 || ! isFixedLatency)
+        return 0;
+
+    return StoneyDSP::Core::Arena::getSizeFor<SampleType>(numChannels * getChannelStride(blockSize))
+         + StoneyDSP::Core::Arena::getSizeFor<SampleType*>(numChannels);
+}
+
+template <typename SampleType>
+void Reblocker<SampleType>::prepare(std::size_t newNumChannels, std::size_t newBlockSize, bool shouldUseFixedLatency, StoneyDSP::Core::Arena& arena)
+{
+    numChannels = newNumChannels;
+    blockSize = newBlockSize;
+    isFixedLatency = shouldUseFixedLatency && newBlockSize > 0;
+    channelStride = getChannelStride(blockSize);
+
+    fifo = {};
+    channelPointers = {};
+
+    if (isFixedLatency)
+    {
+        fifo = arena.allocateArray<SampleType>(numChannels * channelStride);
+        channelPointers = arena.allocateArray<SampleType*>(numChannels);
+
+        // The arena was prepared without room for the FIFO; see getArenaSize().
+        jassert(fifo.size() == numChannels * channelStride && channelPointers.size() == numChannels);
+
+        if (fifo.size() == 0 || channelPointers.size() == 0)
+            numChannels = 0;
+
+        for (std::size_t channel = 0; channel < numChannels; ++channel)
+            channelPointers[channel] = fifo.data() + (channel * channelStride);
+    }
+
+    reset();
+}
+
+template <typename SampleType>
+void Reblocker<SampleType>::reset() noexcept
+{
+    std::fill(fifo.begin(), fifo.end(), static_cast<SampleType>(0.0));
+    numQueued = 0;
+}
+
+template <typename SampleType>
+template <typename OtherSampleType>
+void Reblocker<SampleType>::copyStateFrom(const Reblocker<OtherSampleType>& other) noexcept
+{
+    jassert(other.fifo.size() == fifo.size());
+
+    if (other.fifo.size() != fifo.size())
+        return;
+
+    std::transform(other.fifo.begin(), other.fifo.end(), fifo.begin(), [](OtherSampleType x) { return static_cast<SampleType>(x); });
+    numQueued = other.numQueued;
+}
+
+//==============================================================================
+template class Reblocker<float>;
+template class Reblocker<double>;
+
+template void Reblocker<float>::copyStateFrom<double>(const Reblocker<double>&) noexcept;
+template void Reblocker<double>::copyStateFrom<float>(const Reblocker<float>&) noexcept;
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,177 @@
+/***************************************************************************//**
+ * @file stoneydsp_Reblocker.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Splits, or gathers, host blocks into fixed-size internal blocks.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Audio {
+/** @addtogroup StoneyDSP::Audio @{ */
+
+/**
+ * @brief Hands a processor fixed-size blocks, whatever size the host's
+ * blocks are, in one of two ways:
+ *
+ * - with no latency, each host block is split into whole internal blocks,
+ *   and whatever is left over at the end is passed on as one short block;
+ * - with one internal block of latency, host samples are gathered in a FIFO
+ *   and only ever passed on as whole internal blocks, each channel of which
+ *   is aligned to 64 bytes.
+ *
+ * The FIFO is carved from an arena in ```prepare()```; nothing is allocated
+ * after that.
+ *
+ * @tparam SampleType
+ */
+template <typename SampleType>
+class Reblocker
+{
+public:
+    //==============================================================================
+    /** The internal blocks of each channel start on this boundary, in bytes. */
+    static constexpr std::size_t alignment = 64;
+
+    //==============================================================================
+    Reblocker() = default;
+
+    /** Returns the room that ```prepare()``` takes from an arena, in bytes. */
+    static std::size_t getArenaSize(std::size_t numChannels, std::size_t blockSize, bool isFixedLatency) noexcept;
+
+    /**
+     * @brief Sets the number of channels and the internal block size, and
+     * whether to gather host samples with a block of latency (true) or split
+     * host blocks with none (false). A block size of 0 passes host blocks
+     * straight through. Does not allocate.
+     */
+    void prepare(std::size_t numChannels, std::size_t blockSize, bool isFixedLatency, StoneyDSP::Core::Arena& arena);
+
+    /** Clears the FIFO. */
+    void reset() noexcept;
+
+    /**
+     * @brief Takes over the FIFO of a reblocker of the other precision,
+     * prepared alike. Does not allocate.
+     */
+    template <typename OtherSampleType>
+    void copyStateFrom(const Reblocker<OtherSampleType>& other) noexcept;
+
+    //==============================================================================
+    /** Returns the internal block size, or 0 if host blocks pass straight through. */
+    std::size_t getBlockSize() const noexcept { return blockSize; }
+
+    /** Returns the latency added, in samples: a whole block with the FIFO, or none. */
+    int getLatencySamples() const noexcept { return isFixedLatency ? static_cast<int>(blockSize) : 0; }
+
+    //==============================================================================
+    /**
+     * @brief Runs the host's buffer through ```processBlock```, which is
+     * called with a ```juce::AudioBuffer<SampleType>&``` for each internal
+     * block, in order, and processes it in place.
+     */
+    template <typename Function>
+    void process(juce::AudioBuffer<SampleType>& buffer, Function&& processBlock)
+    {
+        const auto numSamples = static_cast<std::size_t>(buffer.getNumSamples());
+
+        if (blockSize == 0)
+        {
+            processBlock(buffer);
+            return;
+        }
+
+        if (! isFixedLatency)
+        {
+            // The last block is simply shorter; the kernels run sample by
+            // sample, so a short block costs only its own samples.
+            for (std::size_t start = 0; start < numSamples; start += blockSize)
+            {
+                const auto length = std::min(blockSize, numSamples - start);
+
+                juce::AudioBuffer<SampleType> block(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), static_cast<int>(start), static_cast<int>(length));
+                processBlock(block);
+            }
+
+            return;
+        }
+
+        jassert(static_cast<std::size_t>(buffer.getNumChannels()) <= numChannels);
+
+        const auto channels = std::min(static_cast<std::size_t>(buffer.getNumChannels()), numChannels);
+
+        for (std::size_t start = 0; start < numSamples;)
+        {
+            const auto length = std::min(blockSize - numQueued, numSamples - start);
+
+            // Each host sample swaps places with the processed sample one
+            // block behind it, so the FIFO is a single block per channel.
+            for (std::size_t channel = 0; channel < channels; ++channel)
+            {
+                auto* host = buffer.getWritePointer(static_cast<int>(channel), static_cast<int>(start));
+                auto* queued = fifo.data() + (channel * channelStride) + numQueued;
+
+                for (std::size_t i = 0; i < length; ++i)
+                    std::swap(host[i], queued[i]);
+            }
+
+            numQueued += length;
+            start += length;
+
+            if (numQueued == blockSize)
+            {
+                juce::AudioBuffer<SampleType> block(channelPointers.data(), static_cast<int>(channels), static_cast<int>(blockSize));
+                processBlock(block);
+                numQueued = 0;
+            }
+        }
+    }
+
+private:
+    //==============================================================================
+    /** Returns the length of one channel's row of the FIFO, padded to the alignment. */
+    static std::size_t getChannelStride(std::size_t blockSize) noexcept;
+
+    /** One internal block per channel, each row padded to the alignment. */
+    StoneyDSP::Core::ArenaArray<SampleType> fifo;
+    StoneyDSP::Core::ArenaArray<SampleType*> channelPointers;
+
+    std::size_t numChannels = 0, blockSize = 0, channelStride = 0, numQueued = 0;
+    bool isFixedLatency = false;
+
+    template <typename> friend class Reblocker;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Reblocker)
+};
+
+  /// @} group StoneyDSP::Audio
+} // namespace Audio
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,215 @@
+/***************************************************************************//**
+ * @file stoneydsp_Arena.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief A bump allocator that hands out pieces of one aligned block.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP
+{
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+namespace Core
+{
+/** @addtogroup Core
+ *  @{
+ */
+
+/**
+ * @brief A fixed-size, non-owning array of trivially-destructible values,
+ * typically carved from an ```Arena```.
+ *
+ * @tparam ValueType the element type.
+ */
+template <typename ValueType>
+class ArenaArray
+{
+public:
+    ArenaArray() noexcept = default;
+
+    ArenaArray(ValueType* newData, std::size_t newSize) noexcept
+    : elements (newData)
+    , numElements (newSize)
+    {}
+
+    ValueType& operator[](std::size_t index) noexcept               { return elements[index]; }
+    const ValueType& operator[](std::size_t index) const noexcept   { return elements[index]; }
+
+    ValueType* begin() noexcept                 { return elements; }
+    ValueType* end() noexcept                   { return elements + numElements; }
+    const ValueType* begin() const noexcept     { return elements; }
+    const ValueType* end() const noexcept       { return elements + numElements; }
+
+    ValueType* data() noexcept                  { return elements; }
+    const ValueType* data() const noexcept      { return elements; }
+    std::size_t size() const noexcept           { return numElements; }
+
+private:
+    ValueType* elements = nullptr;
+    std::size_t numElements = 0;
+};
+
+/**
+ * @brief One aligned block of memory, handed out piece by piece.
+ *
+ * The owner adds up what everything needs (see ```getSizeFor()```), makes
+ * room with ```prepare()``` - the only call that can allocate - and then
+ * hands the pieces out with ```allocate()```, which never does. Pieces are
+ * given out in order and start on a cache line each, so whatever is carved
+ * in the order it is used sits contiguously in memory.
+ *
+ * Only trivially-destructible types can be placed here; nothing is
+ * destroyed when the arena is prepared again or goes away.
+ */
+class Arena
+{
+public:
+    /** Every piece starts on a boundary of this many bytes. */
+    static constexpr std::size_t alignment = 64;
+
+    Arena() noexcept = default;
+
+    ~Arena()
+    {
+        release();
+    }
+
+    /**
+     * @brief Returns the room that ```count``` values of ```ValueType```
+     * take, including the padding up to the next piece.
+     */
+    template <typename ValueType>
+    static constexpr std::size_t getSizeFor(std::size_t count) noexcept
+    {
+        return roundUp(count * sizeof(ValueType));
+    }
+
+    /**
+     * @brief Makes room for at least ```numBytes```, and starts handing out
+     * pieces from the beginning again; anything handed out before is no
+     * longer valid. Allocates only if the arena has to grow.
+     */
+    void prepare(std::size_t numBytes)
+    {
+        numBytes = roundUp(numBytes);
+
+        if (numBytes > capacity)
+        {
+            release();
+
+            block = static_cast<unsigned char*>(::operator new(numBytes, std::align_val_t { alignment }));
+            capacity = numBytes;
+            ++numAllocations;
+        }
+
+        used = 0;
+    }
+
+    /**
+     * @brief Hands out room for ```count``` value-initialised values. Never
+     * allocates.
+     *
+     * @return the values, or ```nullptr``` if the arena was not prepared
+     * with enough room for them.
+     */
+    template <typename ValueType>
+    ValueType* allocate(std::size_t count) noexcept
+    {
+        static_assert(std::is_trivially_destructible<ValueType>::value, "Nothing in an Arena is ever destroyed.");
+        static_assert(alignof(ValueType) <= alignment, "The type needs a stricter alignment than the Arena gives.");
+
+        const auto numBytes = getSizeFor<ValueType>(count);
+
+        if (block == nullptr || numBytes > capacity - used)
+            return nullptr;
+
+        auto* values = reinterpret_cast<ValueType*>(block + used);
+        used += numBytes;
+
+        for (std::size_t i = 0; i < count; ++i)
+            new (values + i) ValueType();
+
+        return values;
+    }
+
+    /**
+     * @brief Hands out an ```ArenaArray``` of ```count``` values, as
+     * ```allocate()``` does; it is empty if there was not enough room.
+     */
+    template <typename ValueType>
+    ArenaArray<ValueType> allocateArray(std::size_t count) noexcept
+    {
+        auto* values = allocate<ValueType>(count);
+        return { values, values != nullptr ? count : 0 };
+    }
+
+    /** Returns the number of bytes that the arena can hand out. */
+    std::size_t getCapacity() const noexcept { return capacity; }
+
+    /** Returns the number of bytes handed out since the last ```prepare()```. */
+    std::size_t getNumBytesUsed() const noexcept { return used; }
+
+    /**
+     * @brief Returns the number of times the arena has gone to the heap;
+     * this only changes in ```prepare()```, so a count that is the same
+     * after processing as it was after preparing proves that nothing was
+     * allocated in between.
+     */
+    int getNumAllocations() const noexcept { return numAllocations; }
+
+private:
+    static constexpr std::size_t roundUp(std::size_t numBytes) noexcept
+    {
+        return (numBytes + alignment - 1) & ~(alignment - 1);
+    }
+
+    void release() noexcept
+    {
+        if (block != nullptr)
+            ::operator delete(block, std::align_val_t { alignment });
+
+        block = nullptr;
+        capacity = 0;
+        used = 0;
+    }
+
+    unsigned char* block = nullptr;
+    std::size_t capacity = 0;
+    std::size_t used = 0;
+    int numAllocations = 0;
+
+    STONEYDSP_DECLARE_NON_COPYABLE (Arena)
+};
+
+  /// @} group Core
+} // namespace Core
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,115 @@
+/***************************************************************************//**
+ * @file stoneydsp_Mailbox.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief A lock-free, single-producer single-consumer 'latest value' mailbox.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+
+namespace StoneyDSP
+{
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+namespace Core
+{
+/** @addtogroup Core
+ *  @{
+ */
+
+/**
+ * @brief A lock-free mailbox that hands the most recent value from one
+ * producer thread to one consumer thread.
+ *
+ * Three buffers are rotated so that the producer and the consumer never touch
+ * the same one: posting and collecting are a single atomic exchange of buffer
+ * indices, with no locks and no allocation. Values that are posted faster
+ * than they are collected are overwritten; only the latest one is delivered.
+ *
+ * @tparam ValueType a copyable type.
+ */
+template <typename ValueType>
+class Mailbox
+{
+public:
+    /** Construct a new, empty Mailbox object. */
+    Mailbox() noexcept
+    : middle (1)
+    {}
+
+    /**
+     * @brief Producer side: publishes a value, replacing any value that has
+     * not been collected yet.
+     */
+    void post(const ValueType& newValue) noexcept
+    {
+        buffers[(size_t) writeIndex] = newValue;
+        writeIndex = middle.exchange(writeIndex | newValueFlag, std::memory_order_acq_rel) & indexMask;
+    }
+
+    /**
+     * @brief Consumer side: collects the latest value, if one has been posted
+     * since the last call.
+     *
+     * @return a pointer to the collected value, which stays valid until the
+     * next call, or ```nullptr``` if there was nothing new.
+     */
+    const ValueType* collect() noexcept
+    {
+        if ((middle.load(std::memory_order_relaxed) & newValueFlag) == 0)
+            return nullptr;
+
+        readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & indexMask;
+
+        return &buffers[(size_t) readIndex];
+    }
+
+    /** Consumer side: returns true if a value is waiting to be collected. */
+    bool hasNewValue() const noexcept
+    {
+        return (middle.load(std::memory_order_relaxed) & newValueFlag) != 0;
+    }
+
+private:
+    static constexpr int indexMask      = 0x3;
+    static constexpr int newValueFlag   = 0x4;
+
+    std::array<ValueType, 3> buffers {};
+
+    int writeIndex = 0;     // Owned by the producer.
+    int readIndex = 2;      // Owned by the consumer.
+    std::atomic<int> middle;
+
+    STONEYDSP_DECLARE_NON_COPYABLE (Mailbox)
+};
+
+  /// @} group Core
+} // namespace Core
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -61,13 +61,13 @@ Coefficient<SampleType>::~Coefficient() noexcept
 template <typename SampleType>
 SampleType Coefficient<SampleType>::getValue() const noexcept
 {
-    return value.load();
+    return value.load(std::memory_order_relaxed);
 }
 
 template <typename SampleType>
 void Coefficient<SampleType>::setValue(SampleType newValue) noexcept
 {
-    value = newValue;
+    value.store(newValue, std::memory_order_relaxed);
     valueChanged(get());
 }
 
@@ -79,7 +79,7 @@ void Coefficient<SampleType>::valueChanged(SampleType) noexcept
 template <typename SampleType>
 Coefficient<SampleType>& Coefficient<SampleType>::operator= (const Coefficient<SampleType>& other) noexcept
 {
-    value = other.value.load();
+    value.store(other.get(), std::memory_order_relaxed);
     valueChanged(get());
     return *this;
 }
@@ -87,7 +87,7 @@ Coefficient<SampleType>& Coefficient<SampleType>::operator= (const Coefficient<S
 template <typename SampleType>
 Coefficient<SampleType>& Coefficient<SampleType>::operator= (SampleType other) noexcept
 {
-    value = other;
+    value.store(other, std::memory_order_relaxed);
     valueChanged(get());
     return *this;
 }
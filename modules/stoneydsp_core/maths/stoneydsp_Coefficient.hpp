@@ -41,6 +41,16 @@ namespace Maths
  *  @{
  */
 
+/**
+ * @brief A filter coefficient that can be read and written without tearing.
+ *
+ * Loads and stores are relaxed: they are atomic, but they do not order any
+ * other memory access, so they cost no more than a plain load or store. That
+ * keeps per-sample and control-rate coefficient updates cheap; code that
+ * hands coefficients between threads must provide its own ordering.
+ *
+ * @tparam SampleType
+ */
 template <typename SampleType>
 class Coefficient
 {
@@ -55,10 +65,10 @@ public:
     ~Coefficient() noexcept;
 
     /** Returns the Coefficient object's current value. */
-    SampleType get() const noexcept { return value.load(); }
+    SampleType get() const noexcept { return value.load(std::memory_order_relaxed); }
 
     /** Returns the Coefficient object's current value. */
-    operator SampleType() const noexcept { return value.load(); }
+    operator SampleType() const noexcept { return value.load(std::memory_order_relaxed); }
 
     Coefficient<SampleType>& operator=(const Coefficient<SampleType>&) noexcept;
 
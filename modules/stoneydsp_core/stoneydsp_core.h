@@ -146,6 +146,9 @@ private:
 #include "maths/stoneydsp_MathsFunctions.hpp"
 #include "maths/stoneydsp_Coefficient.hpp"
 
+#include "containers/stoneydsp_Mailbox.hpp"
+#include "containers/stoneydsp_Arena.hpp"
+
 #include "application/stoneydsp_Application.hpp"
 #include "application/stoneydsp_ConsoleApplication.hpp"
 
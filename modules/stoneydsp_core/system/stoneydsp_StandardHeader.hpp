@@ -55,7 +55,11 @@
 
 // Standard includes
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <memory>
+#include <new>
 
 #include <stdexcept>
 #include <vector>
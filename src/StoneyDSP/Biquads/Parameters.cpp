@@ -30,6 +30,17 @@ namespace StoneyDSP {
 namespace Biquads {
 /** @addtogroup Biquads  @{ */
 
+template <typename Function>
+void AudioPluginAudioProcessorParameters::forEachParameterID(Function&& function)
+{
+    for (auto* parameterID : { "Master_bypassID", "Master_outputID", "Master_mixID", "Master_osID", "Master_transformID", "Master_attackID", "Master_releaseID", "Master_morphID", "Master_stereoID", "Master_phaseID", "Master_designID", "Master_governorID", "Master_offlineID" })
+        function(juce::String(parameterID));
+
+    for (std::size_t band = 0; band < numBands; ++band)
+        for (auto* parameterName : { "bypass", "frequency", "resonance", "gain", "type", "dynamic", "threshold", "ratio", "lfoDepth", "lfoRate", "lfoShape", "lfoSync", "channel", "slope", "os" })
+            function(getBandParameterID(band, parameterName));
+}
+
 AudioPluginAudioProcessorParameters::AudioPluginAudioProcessorParameters(AudioPluginAudioProcessor& p /* , juce::AudioProcessorValueTreeState& apvts */)
 : audioProcessor  (p)
 , undoManagerPtr  (std::make_unique<juce::UndoManager>())
@@ -39,12 +50,285 @@ AudioPluginAudioProcessorParameters::AudioPluginAudioProcessorParameters(AudioPl
 {
     jassert(undoManagerPtr      != nullptr);
     jassert(apvtsPtr            != nullptr);
+
+    masterBypassValue       = apvts.getRawParameterValue("Master_bypassID");
+    masterOutputValue       = apvts.getRawParameterValue("Master_outputID");
+    masterMixValue          = apvts.getRawParameterValue("Master_mixID");
+    masterOsValue           = apvts.getRawParameterValue("Master_osID");
+    masterTransformValue    = apvts.getRawParameterValue("Master_transformID");
+    masterAttackValue       = apvts.getRawParameterValue("Master_attackID");
+    masterReleaseValue      = apvts.getRawParameterValue("Master_releaseID");
+    masterMorphValue        = apvts.getRawParameterValue("Master_morphID");
+    masterStereoValue       = apvts.getRawParameterValue("Master_stereoID");
+    masterPhaseValue        = apvts.getRawParameterValue("Master_phaseID");
+    masterDesignValue       = apvts.getRawParameterValue("Master_designID");
+    masterGovernorValue     = apvts.getRawParameterValue("Master_governorID");
+    masterOfflineValue      = apvts.getRawParameterValue("Master_offlineID");
+
+    jassert(masterBypassValue       != nullptr);
+    jassert(masterOutputValue       != nullptr);
+    jassert(masterMixValue          != nullptr);
+    jassert(masterOsValue           != nullptr);
+    jassert(masterTransformValue    != nullptr);
+    jassert(masterAttackValue       != nullptr);
+    jassert(masterReleaseValue      != nullptr);
+    jassert(masterMorphValue        != nullptr);
+    jassert(masterStereoValue       != nullptr);
+    jassert(masterPhaseValue        != nullptr);
+    jassert(masterDesignValue       != nullptr);
+    jassert(masterGovernorValue     != nullptr);
+    jassert(masterOfflineValue      != nullptr);
+
+    for (std::size_t band = 0; band < numBands; ++band)
+    {
+        bandBypassValue[band]       = apvts.getRawParameterValue(getBandParameterID(band, "bypass"));
+        bandFrequencyValue[band]    = apvts.getRawParameterValue(getBandParameterID(band, "frequency"));
+        bandResonanceValue[band]    = apvts.getRawParameterValue(getBandParameterID(band, "resonance"));
+        bandGainValue[band]         = apvts.getRawParameterValue(getBandParameterID(band, "gain"));
+        bandTypeValue[band]         = apvts.getRawParameterValue(getBandParameterID(band, "type"));
+        bandDynamicValue[band]      = apvts.getRawParameterValue(getBandParameterID(band, "dynamic"));
+        bandThresholdValue[band]    = apvts.getRawParameterValue(getBandParameterID(band, "threshold"));
+        bandRatioValue[band]        = apvts.getRawParameterValue(getBandParameterID(band, "ratio"));
+        bandLfoDepthValue[band]     = apvts.getRawParameterValue(getBandParameterID(band, "lfoDepth"));
+        bandLfoRateValue[band]      = apvts.getRawParameterValue(getBandParameterID(band, "lfoRate"));
+        bandLfoShapeValue[band]     = apvts.getRawParameterValue(getBandParameterID(band, "lfoShape"));
+        bandLfoSyncValue[band]      = apvts.getRawParameterValue(getBandParameterID(band, "lfoSync"));
+        bandChannelValue[band]      = apvts.getRawParameterValue(getBandParameterID(band, "channel"));
+        bandSlopeValue[band]        = apvts.getRawParameterValue(getBandParameterID(band, "slope"));
+        bandOsValue[band]           = apvts.getRawParameterValue(getBandParameterID(band, "os"));
+
+        jassert(bandBypassValue[band]       != nullptr);
+        jassert(bandFrequencyValue[band]    != nullptr);
+        jassert(bandResonanceValue[band]    != nullptr);
+        jassert(bandGainValue[band]         != nullptr);
+        jassert(bandTypeValue[band]         != nullptr);
+        jassert(bandDynamicValue[band]      != nullptr);
+        jassert(bandThresholdValue[band]    != nullptr);
+        jassert(bandRatioValue[band]        != nullptr);
+        jassert(bandLfoDepthValue[band]     != nullptr);
+        jassert(bandLfoRateValue[band]      != nullptr);
+        jassert(bandLfoShapeValue[band]     != nullptr);
+        jassert(bandLfoSyncValue[band]      != nullptr);
+        jassert(bandChannelValue[band]      != nullptr);
+        jassert(bandSlopeValue[band]        != nullptr);
+        jassert(bandOsValue[band]           != nullptr);
+    }
+
+    for (auto& morphSnapshot : morphSnapshots)
+    {
+        for (std::size_t band = 0; band < numBands; ++band)
+        {
+            morphSnapshot.frequency[band].store(632.455f, std::memory_order_relaxed);
+            morphSnapshot.resonance[band].store(0.10f, std::memory_order_relaxed);
+            morphSnapshot.gain[band].store(0.00f, std::memory_order_relaxed);
+            morphSnapshot.type[band].store(12, std::memory_order_relaxed);
+        }
+    }
+
+    forEachParameterID([this](const juce::String& parameterID) { apvts.addParameterListener(parameterID, this); });
+}
+
+AudioPluginAudioProcessorParameters::~AudioPluginAudioProcessorParameters()
+{
+    forEachParameterID([this](const juce::String& parameterID) { apvts.removeParameterListener(parameterID, this); });
+}
+
+void AudioPluginAudioProcessorParameters::parameterChanged(const juce::String& parameterID, float newValue)
+{
+    juce::ignoreUnused(parameterID, newValue);
+
+    // The APVTS has already stored the new value by the time this is called,
+    // so publishing the new version is all that is needed here.
+    version.fetch_add(1, std::memory_order_release);
+}
+
+void AudioPluginAudioProcessorParameters::getSnapshot(Snapshot& snapshot) const noexcept
+{
+    snapshot.bypass     = masterBypassValue->load(std::memory_order_relaxed) >= 0.5f;
+    snapshot.output     = masterOutputValue->load(std::memory_order_relaxed);
+    snapshot.mix        = masterMixValue->load(std::memory_order_relaxed);
+    snapshot.os         = static_cast<int>(masterOsValue->load(std::memory_order_relaxed));
+    snapshot.transform  = static_cast<int>(masterTransformValue->load(std::memory_order_relaxed));
+    snapshot.attack     = masterAttackValue->load(std::memory_order_relaxed);
+    snapshot.release    = masterReleaseValue->load(std::memory_order_relaxed);
+    snapshot.morph      = masterMorphValue->load(std::memory_order_relaxed);
+    snapshot.stereo     = static_cast<int>(masterStereoValue->load(std::memory_order_relaxed));
+    snapshot.phase      = static_cast<int>(masterPhaseValue->load(std::memory_order_relaxed));
+    snapshot.design     = static_cast<int>(masterDesignValue->load(std::memory_order_relaxed));
+    snapshot.governor   = static_cast<int>(masterGovernorValue->load(std::memory_order_relaxed));
+    snapshot.offline    = static_cast<int>(masterOfflineValue->load(std::memory_order_relaxed));
+
+    for (std::size_t band = 0; band < numBands; ++band)
+    {
+        auto& bandSnapshot = snapshot.bands[band];
+
+        bandSnapshot.bypass     = bandBypassValue[band]->load(std::memory_order_relaxed) >= 0.5f;
+        bandSnapshot.frequency  = bandFrequencyValue[band]->load(std::memory_order_relaxed);
+        bandSnapshot.resonance  = bandResonanceValue[band]->load(std::memory_order_relaxed);
+        bandSnapshot.gain       = bandGainValue[band]->load(std::memory_order_relaxed);
+        bandSnapshot.type       = static_cast<int>(bandTypeValue[band]->load(std::memory_order_relaxed));
+        bandSnapshot.dynamic    = bandDynamicValue[band]->load(std::memory_order_relaxed) >= 0.5f;
+        bandSnapshot.threshold  = bandThresholdValue[band]->load(std::memory_order_relaxed);
+        bandSnapshot.ratio      = bandRatioValue[band]->load(std::memory_order_relaxed);
+        bandSnapshot.lfoDepth   = bandLfoDepthValue[band]->load(std::memory_order_relaxed);
+        bandSnapshot.lfoRate    = bandLfoRateValue[band]->load(std::memory_order_relaxed);
+        bandSnapshot.lfoShape   = static_cast<int>(bandLfoShapeValue[band]->load(std::memory_order_relaxed));
+        bandSnapshot.lfoSync    = static_cast<int>(bandLfoSyncValue[band]->load(std::memory_order_relaxed));
+        bandSnapshot.channel    = static_cast<int>(bandChannelValue[band]->load(std::memory_order_relaxed));
+        bandSnapshot.slope      = static_cast<int>(bandSlopeValue[band]->load(std::memory_order_relaxed));
+        bandSnapshot.os         = static_cast<int>(bandOsValue[band]->load(std::memory_order_relaxed));
+    }
+
+    // The version is read first: a store that lands part-way through the
+    // copy below bumps it afterwards, so the caller copies again next block.
+    snapshot.morphVersion   = morphVersion.load(std::memory_order_acquire);
+    snapshot.morphing       = true;
+
+    for (const auto& morphSnapshot : morphSnapshots)
+        snapshot.morphing = snapshot.morphing && morphSnapshot.stored.load(std::memory_order_relaxed);
+
+    if (! snapshot.morphing)
+        return;
+
+    for (std::size_t slot = 0; slot < numMorphSnapshots; ++slot)
+    {
+        const auto& morphSnapshot = morphSnapshots[slot];
+
+        for (std::size_t band = 0; band < numBands; ++band)
+        {
+            auto& bandSnapshot = snapshot.morphBands[slot][band];
+
+            bandSnapshot.frequency  = morphSnapshot.frequency[band].load(std::memory_order_relaxed);
+            bandSnapshot.resonance  = morphSnapshot.resonance[band].load(std::memory_order_relaxed);
+            bandSnapshot.gain       = morphSnapshot.gain[band].load(std::memory_order_relaxed);
+            bandSnapshot.type       = morphSnapshot.type[band].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void AudioPluginAudioProcessorParameters::storeMorphSnapshot(std::size_t slot)
+{
+    jassert(slot < numMorphSnapshots);
+
+    auto& morphSnapshot = morphSnapshots[slot];
+    auto tree = apvts.state.getOrCreateChildWithName("MorphSnapshots", nullptr).getOrCreateChildWithName("MorphSnapshot_" + juce::String(static_cast<int>(slot)), nullptr);
+
+    for (std::size_t band = 0; band < numBands; ++band)
+    {
+        const auto frequency    = bandFrequencyValue[band]->load(std::memory_order_relaxed);
+        const auto resonance    = bandResonanceValue[band]->load(std::memory_order_relaxed);
+        const auto gain         = bandGainValue[band]->load(std::memory_order_relaxed);
+        const auto type         = static_cast<int>(bandTypeValue[band]->load(std::memory_order_relaxed));
+
+        morphSnapshot.frequency[band].store(frequency, std::memory_order_relaxed);
+        morphSnapshot.resonance[band].store(resonance, std::memory_order_relaxed);
+        morphSnapshot.gain[band].store(gain, std::memory_order_relaxed);
+        morphSnapshot.type[band].store(type, std::memory_order_relaxed);
+
+        tree.setProperty(getBandParameterID(band, "frequency"), frequency, nullptr);
+        tree.setProperty(getBandParameterID(band, "resonance"), resonance, nullptr);
+        tree.setProperty(getBandParameterID(band, "gain"),      gain,      nullptr);
+        tree.setProperty(getBandParameterID(band, "type"),      type,      nullptr);
+    }
+
+    morphSnapshot.stored.store(true, std::memory_order_relaxed);
+    morphSnapshotsChanged();
+}
+
+void AudioPluginAudioProcessorParameters::clearMorphSnapshots()
+{
+    apvts.state.removeChild(apvts.state.getChildWithName("MorphSnapshots"), nullptr);
+
+    for (auto& morphSnapshot : morphSnapshots)
+        morphSnapshot.stored.store(false, std::memory_order_relaxed);
+
+    morphSnapshotsChanged();
+}
+
+bool AudioPluginAudioProcessorParameters::hasMorphSnapshot(std::size_t slot) const noexcept
+{
+    jassert(slot < numMorphSnapshots);
+
+    return morphSnapshots[slot].stored.load(std::memory_order_relaxed);
+}
+
+void AudioPluginAudioProcessorParameters::restoreMorphSnapshots()
+{
+    const auto trees = apvts.state.getChildWithName("MorphSnapshots");
+
+    for (std::size_t slot = 0; slot < numMorphSnapshots; ++slot)
+    {
+        auto& morphSnapshot = morphSnapshots[slot];
+        const auto tree = trees.getChildWithName("MorphSnapshot_" + juce::String(static_cast<int>(slot)));
+
+        morphSnapshot.stored.store(false, std::memory_order_relaxed);
+
+        if (! tree.isValid())
+            continue;
+
+        // Anything missing (e.g. a band added since the state was saved)
+        // falls back to the parameter defaults.
+        for (std::size_t band = 0; band < numBands; ++band)
+        {
+            morphSnapshot.frequency[band].store(static_cast<float>(tree.getProperty(getBandParameterID(band, "frequency"), 632.455f)), std::memory_order_relaxed);
+            morphSnapshot.resonance[band].store(static_cast<float>(tree.getProperty(getBandParameterID(band, "resonance"), 0.10f)), std::memory_order_relaxed);
+            morphSnapshot.gain[band].store(static_cast<float>(tree.getProperty(getBandParameterID(band, "gain"), 0.00f)), std::memory_order_relaxed);
+            morphSnapshot.type[band].store(static_cast<int>(tree.getProperty(getBandParameterID(band, "type"), 12)), std::memory_order_relaxed);
+        }
+
+        morphSnapshot.stored.store(true, std::memory_order_relaxed);
+    }
+
+    morphSnapshotsChanged();
+}
+
+void AudioPluginAudioProcessorParameters::morphSnapshotsChanged() noexcept
+{
+    morphVersion.fetch_add(1, std::memory_order_release);
+    version.fetch_add(1, std::memory_order_release);
+}
+
+juce::String AudioPluginAudioProcessorParameters::getBandName(std::size_t band)
+{
+    jassert(band < numBands);
+
+    return juce::String::charToString(static_cast<juce::juce_wchar>('A' + band));
+}
+
+juce::String AudioPluginAudioProcessorParameters::getBandParameterID(std::size_t band, const char* parameterName)
+{
+    return "Band_" + getBandName(band) + "_" + parameterName + "ID";
+}
+
+double AudioPluginAudioProcessorParameters::getLfoSyncBeats(int lfoSync) noexcept
+{
+    // Matches the order of the "lfoSync" choices: --, 4/1, 2/1, 1/1, 1/2, 1/4, 1/8, 1/16
+    constexpr double beats[] = { 0.0, 16.0, 8.0, 4.0, 2.0, 1.0, 0.5, 0.25 };
+
+    return beats[juce::jlimit(0, static_cast<int>(std::size(beats)) - 1, lfoSync)];
+}
+
+int AudioPluginAudioProcessorParameters::getSlopeDecibels(int slope, bool& isLinkwitzRiley) noexcept
+{
+    // Matches the order of the "slope" choices: 12 to 96 (Butterworth), then LR 24, LR 48, LR 96
+    constexpr int decibels[] = { 12, 24, 36, 48, 60, 72, 84, 96, 24, 48, 96 };
+    constexpr int firstLinkwitzRiley = 8;
+
+    const auto index = juce::jlimit(0, static_cast<int>(std::size(decibels)) - 1, slope);
+
+    isLinkwitzRiley = index >= firstLinkwitzRiley;
+    return decibels[index];
+}
+
+float AudioPluginAudioProcessorParameters::getMinGainDecibels() noexcept
+{
+    return juce::Decibels::gainToDecibels(minGain);
 }
 
 void AudioPluginAudioProcessorParameters::setParameterLayout(juce::AudioProcessorValueTreeState::ParameterLayout& newParameterLayout)
 {
-    const auto dBMax        = juce::Decibels::gainToDecibels(16.0f);
-    const auto dBMin        = juce::Decibels::gainToDecibels(0.0625f);
+    const auto dBMax        = juce::Decibels::gainToDecibels(maxGain);
+    const auto dBMin        = getMinGainDecibels();
     const auto dBOut        = juce::Decibels::gainToDecibels(0.5f, -120.0f) * 20.0f;
 
     const auto freqRange    = juce::NormalisableRange<float>(20.00f,    20000.00f,  0.001f,     00.198894f);
@@ -52,15 +336,35 @@ void AudioPluginAudioProcessorParameters::setParameterLayout(juce::AudioProcesso
     const auto gainRange    = juce::NormalisableRange<float>(dBMin,     dBMax,      0.01f,      1.00f);
     const auto mixRange     = juce::NormalisableRange<float>(00.00f,    100.00f,    0.01f,      1.00f);
     const auto outputRange  = juce::NormalisableRange<float>(dBOut,     dBMax,      0.01f,      1.00f);
+    const auto threshRange  = juce::NormalisableRange<float>(-60.00f,   00.00f,     0.01f,      1.00f);
+    const auto ratioRange   = juce::NormalisableRange<float>(01.00f,    20.00f,     0.01f,      0.50f);
+    const auto attackRange  = juce::NormalisableRange<float>(00.10f,    100.00f,    0.01f,      0.50f);
+    const auto releaseRange = juce::NormalisableRange<float>(01.00f,    1000.00f,   0.01f,      0.50f);
+    const auto depthRange   = juce::NormalisableRange<float>(00.00f,    4.00f,      0.01f,      1.00f);
+    const auto rateRange    = juce::NormalisableRange<float>(00.01f,    20.00f,     0.01f,      0.30f);
+    const auto morphRange   = juce::NormalisableRange<float>(00.00f,    100.00f,    0.01f,      1.00f);
 
     const auto fString      = juce::StringArray({ "LP2", "LP1", "HP2", "HP1" , "BP2", "BP2c", "LS2", "LS1c", "LS1", "HS2", "HS1c", "HS1", "PK2", "NX2", "AP2" });
     const auto tString      = juce::StringArray({ "DFI", "DFII", "DFI t", "DFII t" });
     const auto osString     = juce::StringArray({ "--", "2x", "4x", "8x", "16x" });
+    const auto shapeString  = juce::StringArray({ "Sine", "Triangle", "Saw", "Square" });
+    const auto syncString   = juce::StringArray({ "--", "4/1", "2/1", "1/1", "1/2", "1/4", "1/8", "1/16" });
+    const auto stereoString = juce::StringArray({ "Linked", "Mid/Side", "Left/Right" });
+    const auto phaseString  = juce::StringArray({ "Minimum", "Linear" });
+    const auto designString = juce::StringArray({ "Bilinear", "Matched" });
+    const auto governorString = juce::StringArray({ "Off", "On" });
+    const auto offlineString = juce::StringArray({ "Same", "Best" });
+    const auto chString     = juce::StringArray({ "Both", "Mid/Left", "Side/Right" });
+    const auto slopeString  = juce::StringArray({ "12", "24", "36", "48", "60", "72", "84", "96", "LR 24", "LR 48", "LR 96" });
+    const auto bandOsString = juce::StringArray({ "Never", "Always", "Auto" });
 
     const auto decibels     = juce::String{ ("dB") };
     const auto frequency    = juce::String{ ("Hz") };
     const auto reso         = juce::String{ ("q") };
     const auto percentage   = juce::String{ ("%") };
+    const auto milliseconds = juce::String{ ("ms") };
+    const auto ratio        = juce::String{ (":1") };
+    const auto octaves      = juce::String{ ("oct") };
 
     const auto genParam     = juce::AudioProcessorParameter::genericParameter;
     const auto inMeter      = juce::AudioProcessorParameter::inputMeter;
@@ -90,63 +394,73 @@ void AudioPluginAudioProcessorParameters::setParameterLayout(juce::AudioProcesso
         .withLabel(decibels)
         .withCategory(outParam);
 
-    newParameterLayout.add(
+    auto timeAttributes = juce::AudioParameterFloatAttributes()
+        .withLabel(milliseconds)
+        .withCategory(genParam);
+
+    auto ratioAttributes = juce::AudioParameterFloatAttributes()
+        .withLabel(ratio)
+        .withCategory(genParam);
+
+    auto depthAttributes = juce::AudioParameterFloatAttributes()
+        .withLabel(octaves)
+        .withCategory(genParam);
+
+    //==============================================================================
+    auto masterGroup = std::make_unique<juce::AudioProcessorParameterGroup>("Master_ID", "Master", "seperatorMaster"
         //==============================================================================
-        std::make_unique<juce::AudioProcessorParameterGroup>("Biquads_ID", ProjectInfo::projectName, "seperatorBiquads",
-            //==============================================================================
-            std::make_unique<juce::AudioProcessorParameterGroup>("Master_ID", "Master", "seperatorMaster"
-                //==============================================================================
-                , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ "Master_bypassID",    ProjectInfo::versionNumber}, "Bypass",                          false)
-                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Master_outputID",    ProjectInfo::versionNumber}, "Output",          outputRange,    00.00f, outputAttributes)
-                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Master_mixID",       ProjectInfo::versionNumber}, "Mix",             mixRange,       100.00f, mixAttributes)
-                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_osID",        ProjectInfo::versionNumber}, "Oversampling",    osString,       0)
-                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_transformID", ProjectInfo::versionNumber}, "Transform",       tString,        3)
-            ),
+        , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ "Master_bypassID",    ProjectInfo::versionNumber}, "Bypass",                          false)
+        , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Master_outputID",    ProjectInfo::versionNumber}, "Output",          outputRange,    00.00f, outputAttributes)
+        , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Master_mixID",       ProjectInfo::versionNumber}, "Mix",             mixRange,       100.00f, mixAttributes)
+        , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_osID",        ProjectInfo::versionNumber}, "Oversampling",    osString,       0)
+        , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_transformID", ProjectInfo::versionNumber}, "Transform",       tString,        3)
+        , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Master_attackID",    ProjectInfo::versionNumber}, "Attack",          attackRange,    10.00f, timeAttributes)
+        , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Master_releaseID",   ProjectInfo::versionNumber}, "Release",         releaseRange,   100.00f, timeAttributes)
+        , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Master_morphID",     ProjectInfo::versionNumber}, "Morph",           morphRange,     00.00f, mixAttributes)
+        , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_stereoID",    ProjectInfo::versionNumber}, "Stereo",          stereoString,   0)
+        , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_phaseID",     ProjectInfo::versionNumber}, "Phase",           phaseString,    0)
+        , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_designID",    ProjectInfo::versionNumber}, "Design",          designString,   0)
+        , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_governorID",  ProjectInfo::versionNumber}, "Governor",        governorString, 0)
+        , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Master_offlineID",   ProjectInfo::versionNumber}, "Offline",         offlineString,  0)
+    );
+
+    //==============================================================================
+    auto processorGroup = std::make_unique<juce::AudioProcessorParameterGroup>("Processor_ID", ProjectInfo::versionString, "seperatorProcessor");
+
+    // Only the first band is switched on by default.
+    for (std::size_t band = 0; band < numBands; ++band)
+    {
+        const auto bandName = getBandName(band);
+
+        processorGroup->addChild(
             //==============================================================================
-            std::make_unique<juce::AudioProcessorParameterGroup>("Processor_ID", ProjectInfo::versionString, "seperatorProcessor",
-                //==============================================================================
-                std::make_unique<juce::AudioProcessorParameterGroup>("Band_A_ID", "Band A", "seperatorA"
-                    //==============================================================================
-                    , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ "Band_A_bypassID",    ProjectInfo::versionNumber}, "Bypass",                  false)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_A_frequencyID", ProjectInfo::versionNumber}, "Frequency",   freqRange,  632.455f,   freqAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_A_resonanceID", ProjectInfo::versionNumber}, "Resonance",   resRange,   00.10f,     resoAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_A_gainID",      ProjectInfo::versionNumber}, "Gain",        gainRange,  00.00f,     gainAttributes)
-                    , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Band_A_typeID",      ProjectInfo::versionNumber}, "Type",        fString,    12)
-                    //==============================================================================
-                ),
+            std::make_unique<juce::AudioProcessorParameterGroup>("Band_" + bandName + "_ID", "Band " + bandName, "seperator" + bandName
                 //==============================================================================
-                std::make_unique<juce::AudioProcessorParameterGroup>("Band_B_ID", "Band B", "seperatorB"
-                    //==============================================================================
-                    , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ "Band_B_bypassID",    ProjectInfo::versionNumber}, "Bypass",                  true)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_B_frequencyID", ProjectInfo::versionNumber}, "Frequency",   freqRange,  632.455f,   freqAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_B_resonanceID", ProjectInfo::versionNumber}, "Resonance",   resRange,   00.10f,     resoAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_B_gainID",      ProjectInfo::versionNumber}, "Gain",        gainRange,  00.00f,     gainAttributes)
-                    , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Band_B_typeID",      ProjectInfo::versionNumber}, "Type",        fString,    12)
-                    //==============================================================================
-                ),
-                //==============================================================================
-                std::make_unique<juce::AudioProcessorParameterGroup>("Band_C_ID", "Band C", "seperatorC"
-                    //==============================================================================
-                    , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ "Band_C_bypassID",    ProjectInfo::versionNumber}, "Bypass",                  true)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_C_frequencyID", ProjectInfo::versionNumber}, "Frequency",   freqRange,  632.455f,   freqAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_C_resonanceID", ProjectInfo::versionNumber}, "Resonance",   resRange,   00.10f,     resoAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_C_gainID",      ProjectInfo::versionNumber}, "Gain",        gainRange,  00.00f,     gainAttributes)
-                    , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Band_C_typeID",      ProjectInfo::versionNumber}, "Type",        fString,    12)
-                    //==============================================================================
-                ),
-                //==============================================================================
-                std::make_unique<juce::AudioProcessorParameterGroup>("Band_D_ID", "Band D", "seperatorD"
-                    //==============================================================================
-                    , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ "Band_D_bypassID",    ProjectInfo::versionNumber}, "Bypass",                  true)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_D_frequencyID", ProjectInfo::versionNumber}, "Frequency",   freqRange,  632.455f,   freqAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_D_resonanceID", ProjectInfo::versionNumber}, "Resonance",   resRange,   00.10f,     resoAttributes)
-                    , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ "Band_D_gainID",      ProjectInfo::versionNumber}, "Gain",        gainRange,  00.00f,     gainAttributes)
-                    , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ "Band_D_typeID",      ProjectInfo::versionNumber}, "Type",        fString,    12)
-                    //==============================================================================
-                )
+                , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ getBandParameterID(band, "bypass"),    ProjectInfo::versionNumber}, "Bypass",                  band != 0)
+                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ getBandParameterID(band, "frequency"), ProjectInfo::versionNumber}, "Frequency",   freqRange,  632.455f,   freqAttributes)
+                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ getBandParameterID(band, "resonance"), ProjectInfo::versionNumber}, "Resonance",   resRange,   00.10f,     resoAttributes)
+                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ getBandParameterID(band, "gain"),      ProjectInfo::versionNumber}, "Gain",        gainRange,  00.00f,     gainAttributes)
+                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ getBandParameterID(band, "type"),      ProjectInfo::versionNumber}, "Type",        fString,    12)
+                , std::make_unique<juce::AudioParameterBool>  (juce::ParameterID{ getBandParameterID(band, "dynamic"),   ProjectInfo::versionNumber}, "Dynamic",                 false)
+                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ getBandParameterID(band, "threshold"), ProjectInfo::versionNumber}, "Threshold",   threshRange, -24.00f,   gainAttributes)
+                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ getBandParameterID(band, "ratio"),     ProjectInfo::versionNumber}, "Ratio",       ratioRange, 02.00f,     ratioAttributes)
+                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ getBandParameterID(band, "lfoDepth"),  ProjectInfo::versionNumber}, "LFO Depth",   depthRange, 00.00f,     depthAttributes)
+                , std::make_unique<juce::AudioParameterFloat> (juce::ParameterID{ getBandParameterID(band, "lfoRate"),   ProjectInfo::versionNumber}, "LFO Rate",    rateRange,  01.00f,     freqAttributes)
+                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ getBandParameterID(band, "lfoShape"),  ProjectInfo::versionNumber}, "LFO Shape",   shapeString, 0)
+                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ getBandParameterID(band, "lfoSync"),   ProjectInfo::versionNumber}, "LFO Sync",    syncString, 0)
+                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ getBandParameterID(band, "channel"),   ProjectInfo::versionNumber}, "Channel",     chString,   0)
+                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ getBandParameterID(band, "slope"),     ProjectInfo::versionNumber}, "Slope",       slopeString, 0)
+                , std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{ getBandParameterID(band, "os"),        ProjectInfo::versionNumber}, "Oversampling", bandOsString, 2)
                 //==============================================================================
             )
-            //==============================================================================
+        );
+    }
+
+    newParameterLayout.add(
+        //==============================================================================
+        std::make_unique<juce::AudioProcessorParameterGroup>("Biquads_ID", ProjectInfo::projectName, "seperatorBiquads"
+            , std::move(masterGroup)
+            , std::move(processorGroup)
         )
         //==============================================================================
     );
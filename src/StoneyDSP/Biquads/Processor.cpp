@@ -36,6 +36,7 @@ AudioPluginAudioProcessor::AudioPluginAudioProcessor()
 #if ! JucePlugin_IsMidiEffect
  #if ! JucePlugin_IsSynth
     .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
+    .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false)
  #endif
     .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
 #endif
@@ -45,23 +46,23 @@ AudioPluginAudioProcessor::AudioPluginAudioProcessor()
   , parameters(*parametersPtr.get())
   , undoManager(parameters.getUndoManager())
   , apvts(parameters.getApvts())
-  , processorFltPtr(std::make_unique<AudioPluginAudioProcessorWrapper<float>>(*this, parameters.getApvts(), getSpec()))
-  , processorDblPtr(std::make_unique<AudioPluginAudioProcessorWrapper<double>>(*this, parameters.getApvts(), getSpec()))
-  , processorFlt(*processorFltPtr.get())
-  , processorDbl(*processorDblPtr.get())
   , bypassState(dynamic_cast <juce::AudioParameterBool*>(parameters.getApvts().getParameter("Master_bypassID")))
+  , offlineState(dynamic_cast <juce::AudioParameterChoice*>(parameters.getApvts().getParameter("Master_offlineID")))
 {
-    bypassState = dynamic_cast <juce::AudioParameterBool*>(parameters.getApvts().getParameter("Master_bypassID"));
+    updateProcessor();
+
+    startTimerHz(10);
 
     jassert(parametersPtr       != nullptr);
-    jassert(processorFltPtr     != nullptr);
-    jassert(processorFltPtr     != nullptr);
+    jassert(processorFltPtr     != nullptr || processorDblPtr != nullptr);
 
     jassert(bypassState         != nullptr);
+    jassert(offlineState        != nullptr);
 }
 
 AudioPluginAudioProcessor::~AudioPluginAudioProcessor()
 {
+    stopTimer();
 }
 
 //==============================================================================
@@ -103,17 +104,169 @@ bool AudioPluginAudioProcessor::isUsingDoublePrecision() const noexcept
     return processingPrecision == doublePrecision;
 }
 
+bool AudioPluginAudioProcessor::isUsingTinyBlockPath() const noexcept
+{
+    // In mixed precision, the wrapper of the other precision is the one running.
+    if (isUsingDoublePrecision() != isMixedPrecision)
+        return processorDblPtr != nullptr && processorDblPtr->isUsingTinyBlockPath();
+
+    return processorFltPtr != nullptr && processorFltPtr->isUsingTinyBlockPath();
+}
+
 void AudioPluginAudioProcessor::setProcessingPrecision(juce::AudioProcessor::ProcessingPrecision newPrecision) noexcept
 {
     // If you hit this assertion then you're trying to use double precision
     // processing on a processor which does not support it!
     jassert(newPrecision != doublePrecision || supportsDoublePrecisionProcessing());
 
-    if (processingPrecision != newPrecision)
+    if (processingPrecision == newPrecision)
+        return;
+
+    // In mixed precision, the wrapper of the new precision is already running.
+    if (isMixedPrecision)
     {
+        const juce::ScopedLock lock (getCallbackLock());
+
         processingPrecision = newPrecision;
-        releaseResources();
-        reset();
+        isMixedPrecision = false;
+        return;
+    }
+
+    if (newPrecision == doublePrecision)
+        switchProcessor(processorFltPtr, processorDblPtr, newPrecision);
+    else
+        switchProcessor(processorDblPtr, processorFltPtr, newPrecision);
+}
+
+template <typename OldSampleType, typename NewSampleType>
+void AudioPluginAudioProcessor::switchProcessor(std::unique_ptr<AudioPluginAudioProcessorWrapper<OldSampleType>>& oldProcessor,
+                                                std::unique_ptr<AudioPluginAudioProcessorWrapper<NewSampleType>>& newProcessor,
+                                                juce::AudioProcessor::ProcessingPrecision newPrecision,
+                                                bool newMixedPrecision)
+{
+    // Everything that allocates happens here, before the switch...
+    if (newProcessor == nullptr)
+        newProcessor = std::make_unique<AudioPluginAudioProcessorWrapper<NewSampleType>>(*this, parameters.getApvts(), getSpec());
+
+    const bool isPrepared = spec.sampleRate > 0.0;
+
+    if (isPrepared)
+        newProcessor->prepare(getSpec());
+
+    // ...and the switch itself only copies, between two blocks.
+    {
+        const juce::ScopedLock lock (getCallbackLock());
+
+        if (isPrepared && oldProcessor != nullptr)
+            newProcessor->copyStateFrom(*oldProcessor);
+
+        processingPrecision = newPrecision;
+        isMixedPrecision = newMixedPrecision;
+    }
+
+    oldProcessor.reset();
+}
+
+void AudioPluginAudioProcessor::timerCallback()
+{
+    updateProcessingMode();
+
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+    if (spec.sampleRate <= 0.0)
+        return;
+
+    if (processorFltPtr != nullptr)
+        processorFltPtr->updateCoefficientTables();
+
+    if (processorDblPtr != nullptr)
+        processorDblPtr->updateCoefficientTables();
+#endif
+}
+
+void AudioPluginAudioProcessor::updateProcessingMode()
+{
+    if (spec.sampleRate <= 0.0)
+        return;
+
+    const bool isRendering = isNonRealtime();
+    const bool isOffline = isRendering && offlineState->getIndex() != 0;
+
+    // Wide buffers are shared out across a pool of threads offline; it is
+    // made the first time it is needed, and kept from then on.
+    if (isOffline && offlinePool == nullptr)
+    {
+        auto newPool = std::make_unique<juce::ThreadPool>();
+
+        const juce::ScopedLock lock (getCallbackLock());
+        offlinePool = std::move(newPool);
+    }
+
+    // A governed double-precision host may be run in single precision, and
+    // a single-precision host rendering offline is run in double.
+    const bool shouldRunDouble = isOffline || (isUsingDoublePrecision() && ! wantsMixedPrecision.load(std::memory_order_relaxed));
+    const bool isRunningDouble = isUsingDoublePrecision() != isMixedPrecision;
+
+    if (shouldRunDouble != isRunningDouble)
+    {
+        const bool newMixedPrecision = shouldRunDouble != isUsingDoublePrecision();
+        const auto numChannels = std::max(getTotalNumInputChannels(), getTotalNumOutputChannels());
+        const auto maximumBlockSize = static_cast<int>(spec.maximumBlockSize);
+
+        if (newMixedPrecision && shouldRunDouble)
+            mixedPrecisionDblBuffer.setSize(numChannels, maximumBlockSize);
+        else if (newMixedPrecision)
+            mixedPrecisionFltBuffer.setSize(numChannels, maximumBlockSize);
+
+        if (shouldRunDouble)
+            switchProcessor(processorFltPtr, processorDblPtr, processingPrecision, newMixedPrecision);
+        else
+            switchProcessor(processorDblPtr, processorFltPtr, processingPrecision, newMixedPrecision);
+
+        if (! newMixedPrecision)
+        {
+            mixedPrecisionFltBuffer.setSize(0, 0);
+            mixedPrecisionDblBuffer.setSize(0, 0);
+        }
+    }
+
+    if (processorFltPtr != nullptr)
+        updateOfflineQuality(*processorFltPtr, isOffline);
+
+    if (processorDblPtr != nullptr)
+        updateOfflineQuality(*processorDblPtr, isOffline);
+
+    isRenderingOffline.store(isRendering, std::memory_order_relaxed);
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessor::updateOfflineQuality(AudioPluginAudioProcessorWrapper<SampleType>& processor, bool isOffline)
+{
+    if (processor.isUsingOfflineQuality() == isOffline)
+        return;
+
+    // Every band is moved to its new rate and designed again, between two
+    // blocks; the audio thread waits on the lock for the one block.
+    const juce::ScopedLock lock (getCallbackLock());
+    processor.setOfflineQuality(isOffline, offlinePool.get());
+}
+
+void AudioPluginAudioProcessor::updateProcessor()
+{
+    // The wrapper of the precision not in use is a whole second set of
+    // bands, mixer and buffers; it is only made if the host switches over.
+    if (isUsingDoublePrecision() == isMixedPrecision)
+    {
+        if (processorFltPtr == nullptr)
+            processorFltPtr = std::make_unique<AudioPluginAudioProcessorWrapper<float>>(*this, parameters.getApvts(), getSpec());
+
+        processorDblPtr.reset();
+    }
+    else
+    {
+        if (processorDblPtr == nullptr)
+            processorDblPtr = std::make_unique<AudioPluginAudioProcessorWrapper<double>>(*this, parameters.getApvts(), getSpec());
+
+        processorFltPtr.reset();
     }
 }
 //==============================================================================
@@ -184,9 +337,6 @@ void AudioPluginAudioProcessor::changeProgramName (int index, const juce::String
 //==============================================================================
 void AudioPluginAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    AudioPluginAudioProcessorWrapper<float>&  processorFloat = *processorFltPtr.get();
-    AudioPluginAudioProcessorWrapper<double>& processorDouble = *processorDblPtr.get();
-
     // Use this method as the place to do any pre-playback
     // initialisation that you need..
     processingPrecision = getProcessingPrecision();
@@ -195,33 +345,32 @@ void AudioPluginAudioProcessor::prepareToPlay (double sampleRate, int samplesPer
     spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
 
+    // Playback starts again at full quality.
+    governor.prepare(sampleRate);
+    wantsMixedPrecision.store(false);
+    isMixedPrecision = false;
+    mixedPrecisionFltBuffer.setSize(0, 0);
+    mixedPrecisionDblBuffer.setSize(0, 0);
+
+    updateProcessor();
+
     if(!isUsingDoublePrecision())
-    {
-        processorFloat.prepare(getSpec());
-        processorDouble.reset(0.0);
-    }
+        getProcessorFlt().prepare(getSpec());
     else
-    {
-        processorFloat.reset(0.0f);
-        processorDouble.prepare(getSpec());
-    }
+        getProcessorDbl().prepare(getSpec());
+
+    updateProcessingMode();
 }
 
 void AudioPluginAudioProcessor::releaseResources()
 {
-    AudioPluginAudioProcessorWrapper<float>&  processorFloat  = getProcessorFlt();
-    AudioPluginAudioProcessorWrapper<double>& processorDouble = getProcessorDbl();
-
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
-    if(!isUsingDoublePrecision())
-    {
-        processorFloat.reset(0.0f);
-    }
-    else
-    {
-        processorDouble.reset(0.0);
-    }
+    if (processorFltPtr != nullptr)
+        processorFltPtr->reset(0.0f);
+
+    if (processorDblPtr != nullptr)
+        processorDblPtr->reset(0.0);
 }
 
 bool AudioPluginAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
@@ -230,18 +379,31 @@ bool AudioPluginAudioProcessor::isBusesLayoutSupported (const BusesLayout& layou
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Every channel is filtered alike, so any layout will do - mono, stereo,
+    // surround up to 7.1.4 or ambisonics up to third order - as long as it
+    // fits in maxNumChannels.
+    const auto mainOutput = layouts.getMainOutputChannelSet();
+
+    if (mainOutput.isDisabled() || mainOutput.size() > maxNumChannels)
         return false;
 
     // This checks if the input layout matches the output layout
    #if ! JucePlugin_IsSynth
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
+
+    // The optional sidechain (for the dynamic bands) may be off, mono,
+    // stereo or the same layout as the main bus.
+    if (layouts.getBusCount(true) > 1)
+    {
+        const auto sidechain = layouts.getChannelSet(true, 1);
+
+        if (! sidechain.isDisabled()
+         && sidechain != juce::AudioChannelSet::mono()
+         && sidechain != juce::AudioChannelSet::stereo()
+         && sidechain != mainOutput)
+            return false;
+    }
    #endif
 
     return true;
@@ -254,11 +416,17 @@ void AudioPluginAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     {
         jassert (! isUsingDoublePrecision());
 
-        AudioPluginAudioProcessorWrapper<float>& processor = getProcessorFlt();
-
         juce::ScopedNoDenormals noDenormals;
 
-        processor.process(buffer, midiMessages);
+        if (isMixedPrecision)
+        {
+            processMixedPrecision(buffer, mixedPrecisionDblBuffer, getProcessorDbl(), midiMessages);
+            return;
+        }
+
+        AudioPluginAudioProcessorWrapper<float>& processor = getProcessorFlt();
+
+        processWrapper(processor, buffer, midiMessages);
     }
     else
     {
@@ -272,11 +440,17 @@ void AudioPluginAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer,
     {
         jassert (isUsingDoublePrecision());
 
-        AudioPluginAudioProcessorWrapper<double>& processor = getProcessorDbl();
-
         juce::ScopedNoDenormals noDenormals;
 
-        processor.process(buffer, midiMessages);
+        if (isMixedPrecision)
+        {
+            processMixedPrecision(buffer, mixedPrecisionFltBuffer, getProcessorFlt(), midiMessages);
+            return;
+        }
+
+        AudioPluginAudioProcessorWrapper<double>& processor = getProcessorDbl();
+
+        processWrapper(processor, buffer, midiMessages);
     }
     else
     {
@@ -288,6 +462,10 @@ void AudioPluginAudioProcessor::processBlockBypassed(juce::AudioBuffer<float>& b
 {
     jassert (! isUsingDoublePrecision());
 
+    // Bypass passes the buffer through as it is, in any precision.
+    if (isMixedPrecision)
+        return;
+
     AudioPluginAudioProcessorWrapper<float>& processor = getProcessorFlt();
 
     processor.processBypass(buffer, midiMessages);
@@ -297,11 +475,80 @@ void AudioPluginAudioProcessor::processBlockBypassed(juce::AudioBuffer<double>&
 {
     jassert (isUsingDoublePrecision());
 
+    // Bypass passes the buffer through as it is, in any precision.
+    if (isMixedPrecision)
+        return;
+
     AudioPluginAudioProcessorWrapper<double>& processor = getProcessorDbl();
 
     processor.processBypass(buffer, midiMessages);
 }
 
+template <typename SampleType>
+void AudioPluginAudioProcessor::processWrapper(AudioPluginAudioProcessorWrapper<SampleType>& processor, juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages)
+{
+    // Offline, time doesn't matter, only quality; the offline quality path
+    // itself is switched by updateProcessingMode().
+    const bool isOffline = isRenderingOffline.load(std::memory_order_relaxed);
+
+    const bool isGoverned = ! isOffline && processor.isGovernorOn();
+    const bool canLowerPrecision = isUsingDoublePrecision();
+
+    if (! isGoverned)
+    {
+        if (governor.getTier() != 0)
+            governor.reset();
+
+        wantsMixedPrecision.store(false, std::memory_order_relaxed);
+        processor.setQualityTier(0, canLowerPrecision);
+        processor.process(buffer, midiMessages);
+        return;
+    }
+
+    governor.setNumTiers(processor.getNumQualityTiers(canLowerPrecision));
+    wantsMixedPrecision.store(processor.setQualityTier(governor.getTier(), canLowerPrecision), std::memory_order_relaxed);
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    processor.process(buffer, midiMessages);
+
+    const auto elapsedTicks = juce::Time::getHighResolutionTicks() - startTicks;
+
+    governor.update(juce::Time::highResolutionTicksToSeconds(elapsedTicks), buffer.getNumSamples());
+}
+
+template <typename HostSampleType, typename SampleType>
+void AudioPluginAudioProcessor::processMixedPrecision(juce::AudioBuffer<HostSampleType>& buffer, juce::AudioBuffer<SampleType>& mixedBuffer, AudioPluginAudioProcessorWrapper<SampleType>& processor, juce::MidiBuffer& midiMessages)
+{
+    const auto numChannels = std::min(buffer.getNumChannels(), mixedBuffer.getNumChannels());
+    const auto numSamples = buffer.getNumSamples();
+
+    jassert(numSamples <= static_cast<int>(spec.maximumBlockSize));
+
+    // Fits within the size made in updateProcessingMode(), so doesn't allocate.
+    mixedBuffer.setSize(numChannels, numSamples, false, false, true);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const auto* input = buffer.getReadPointer(channel);
+        auto* output = mixedBuffer.getWritePointer(channel);
+
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = static_cast<SampleType>(input[i]);
+    }
+
+    processWrapper(processor, mixedBuffer, midiMessages);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const auto* input = mixedBuffer.getReadPointer(channel);
+        auto* output = buffer.getWritePointer(channel);
+
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = static_cast<HostSampleType>(input[i]);
+    }
+}
+
 //==============================================================================
 bool AudioPluginAudioProcessor::hasEditor() const
 {
@@ -350,6 +597,8 @@ void AudioPluginAudioProcessor::setStateInformation (const void* data, int sizeI
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(valueTreeState.state.getType()))
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
+
+    parameters.restoreMorphSnapshots();
 }
 
 void AudioPluginAudioProcessor::setCurrentProgramStateInformation(const void* data, int sizeInBytes)
@@ -363,6 +612,8 @@ void AudioPluginAudioProcessor::setCurrentProgramStateInformation(const void* da
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(valueTreeState.state.getType()))
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
+
+    parameters.restoreMorphSnapshots();
 }
 
   /// @} group Biquads
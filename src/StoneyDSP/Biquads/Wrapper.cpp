@@ -36,123 +36,44 @@ AudioPluginAudioProcessorWrapper<SampleType>::AudioPluginAudioProcessorWrapper(A
 , state(apvts)
 , setup(spec)
 
-, mixer(std::make_unique<juce::dsp::DryWetMixer<SampleType>>())
-
-, biquadArraySize(static_cast<std::size_t>(4)) // cannot ‘dynamic_cast’ this - target  typeis not pointer or reference...
-
-, masterBypassPtr(dynamic_cast <juce::AudioParameterBool*>(apvts.getParameter("Master_bypassID")))
-, masterOutputPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Master_outputID")))
-, masterMixPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Master_mixID")))
-, masterOsPtr(dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Master_osID")))
-, masterTransformPtr(dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Master_transformID")))
-
-, biquadsABypassPtr(dynamic_cast <juce::AudioParameterBool*>(apvts.getParameter("Band_A_bypassID")))
-, biquadsAFrequencyPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_A_frequencyID")))
-, biquadsAResonancePtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_A_resonanceID")))
-, biquadsAGainPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_A_gainID")))
-, biquadsATypePtr(dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_A_typeID")))
-
-, biquadsBBypassPtr(dynamic_cast <juce::AudioParameterBool*>(apvts.getParameter("Band_B_bypassID")))
-, biquadsBFrequencyPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_B_frequencyID")))
-, biquadsBResonancePtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_B_resonanceID")))
-, biquadsBGainPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_B_gainID")))
-, biquadsBTypePtr(dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_B_typeID")))
-
-, biquadsCBypassPtr(dynamic_cast <juce::AudioParameterBool*>(apvts.getParameter("Band_C_bypassID")))
-, biquadsCFrequencyPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_C_frequencyID")))
-, biquadsCResonancePtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_C_resonanceID")))
-, biquadsCGainPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_C_gainID")))
-, biquadsCTypePtr(dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_C_typeID")))
-
-, biquadsDBypassPtr(dynamic_cast <juce::AudioParameterBool*>(apvts.getParameter("Band_D_bypassID")))
-, biquadsDFrequencyPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_D_frequencyID")))
-, biquadsDResonancePtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_D_resonanceID")))
-, biquadsDGainPtr(dynamic_cast <juce::AudioParameterFloat*>(apvts.getParameter("Band_D_gainID")))
-, biquadsDTypePtr(dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_D_typeID")))
-
-, bypassState(dynamic_cast <juce::AudioParameterBool*>(apvts.getParameter("Master_bypassID")))
-{
-
-    masterBypassPtr         = dynamic_cast <juce::AudioParameterBool*>  (apvts.getParameter("Master_bypassID"));
-    masterOutputPtr         = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Master_outputID"));
-    masterMixPtr            = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Master_mixID"));
-    masterOsPtr             = dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Master_osID"));
-    masterTransformPtr      = dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Master_transformID"));
-
-    biquadsABypassPtr       = dynamic_cast <juce::AudioParameterBool*>  (apvts.getParameter("Band_A_bypassID"));
-    biquadsAFrequencyPtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_A_frequencyID"));
-    biquadsAResonancePtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_A_resonanceID"));
-    biquadsAGainPtr         = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_A_gainID"));
-    biquadsATypePtr         = dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_A_typeID"));
-
-    biquadsBBypassPtr       = dynamic_cast <juce::AudioParameterBool*>  (apvts.getParameter("Band_B_bypassID"));
-    biquadsBFrequencyPtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_B_frequencyID"));
-    biquadsBResonancePtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_B_resonanceID"));
-    biquadsBGainPtr         = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_B_gainID"));
-    biquadsBTypePtr         = dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_B_typeID"));
-
-    biquadsCBypassPtr       = dynamic_cast <juce::AudioParameterBool*>  (apvts.getParameter("Band_C_bypassID"));
-    biquadsCFrequencyPtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_C_frequencyID"));
-    biquadsCResonancePtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_C_resonanceID"));
-    biquadsCGainPtr         = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_C_gainID"));
-    biquadsCTypePtr         = dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_C_typeID"));
-
-    biquadsDBypassPtr       = dynamic_cast <juce::AudioParameterBool*>  (apvts.getParameter("Band_D_bypassID"));
-    biquadsDFrequencyPtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_D_frequencyID"));
-    biquadsDResonancePtr    = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_D_resonanceID"));
-    biquadsDGainPtr         = dynamic_cast <juce::AudioParameterFloat*> (apvts.getParameter("Band_D_gainID"));
-    biquadsDTypePtr         = dynamic_cast <juce::AudioParameterChoice*>(apvts.getParameter("Band_D_typeID"));
-
-    bypassState             = dynamic_cast <juce::AudioParameterBool*>  (apvts.getParameter("Master_bypassID"));
-
-    jassert(masterBypassPtr             != nullptr);
-    jassert(masterOutputPtr             != nullptr);
-    jassert(masterMixPtr                != nullptr);
-    jassert(masterOsPtr                 != nullptr);
-    jassert(masterTransformPtr          != nullptr);
-
-    jassert(biquadsABypassPtr           != nullptr);
-    jassert(biquadsAFrequencyPtr        != nullptr);
-    jassert(biquadsAResonancePtr        != nullptr);
-    jassert(biquadsAGainPtr             != nullptr);
-    jassert(biquadsATypePtr             != nullptr);
-
-    jassert(biquadsBBypassPtr           != nullptr);
-    jassert(biquadsBFrequencyPtr        != nullptr);
-    jassert(biquadsBResonancePtr        != nullptr);
-    jassert(biquadsBGainPtr             != nullptr);
-    jassert(biquadsBTypePtr             != nullptr);
-
-    jassert(biquadsCBypassPtr           != nullptr);
-    jassert(biquadsCFrequencyPtr        != nullptr);
-    jassert(biquadsCResonancePtr        != nullptr);
-    jassert(biquadsCGainPtr             != nullptr);
-    jassert(biquadsCTypePtr             != nullptr);
-
-    jassert(biquadsDBypassPtr           != nullptr);
-    jassert(biquadsDFrequencyPtr        != nullptr);
-    jassert(biquadsDResonancePtr        != nullptr);
-    jassert(biquadsDGainPtr             != nullptr);
-    jassert(biquadsDTypePtr             != nullptr);
-
-    jassert(bypassState                 != nullptr);
+, mixer(std::make_unique<StoneyDSP::Audio::DryWetMixer<SampleType>>(linearPhaseType::maxLatencySamples))
+, linearPhase(std::make_unique<linearPhaseType>(STONEYDSP_BIQUADS_LINEAR_PHASE_HEAD_SIZE))
+, envelope(std::make_unique<juce::dsp::BallisticsFilter<SampleType>>())
 
+, parameters(p.getParameters())
+{
     jassert(biquadArraySize             != static_cast<std::size_t>(0));
 
-    // auto osFilter = juce::dsp::Oversampling<SampleType>::filterHalfBandFIREquiripple;
+    static_assert(biquadArraySize * StoneyDSP::Audio::BiquadsCascade<SampleType>::maxSections <= linearPhaseType::maxSections,
+                  "The linear-phase kernel must have room for every section of every band.");
+
+#if STONEYDSP_BIQUADS_USING_SHARED_COEFFICIENT_CACHE
+    // Every instance in the process designs through the same cache.
+    for (auto& biquad : biquadArray)
+        biquad.setCoefficientCache(&StoneyDSP::Audio::BiquadsCoefficientCache<SampleType>::getInstance());
+#endif
 
-    // for (int i = 0; i < 5; ++i)
-    //     oversampler[i] = std::make_unique<juce::dsp::Oversampling<SampleType>>
-    //     (audioProcessor.getTotalNumInputChannels(), i, osFilter, true, false);
+    activeBands.fill(static_cast<std::size_t>(0));
+    modulatedBands.fill(static_cast<std::size_t>(0));
+    bandWasActive.fill(false);
+    bandWasModulated.fill(false);
+    bandIsCascade.fill(false);
+    lfoPhase.fill(0.0);
 
-    for (std::size_t i = 0; i < biquadArraySize; ++i)
-        biquadArray[i] = std::make_unique<StoneyDSP::Audio::Biquads<SampleType>>();
+    envelope->setLevelCalculationType(juce::dsp::BallisticsFilterLevelCalculationType::peak);
+
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    designService = std::make_unique<designServiceType>(biquadArraySize);
+#endif
 
     reset(static_cast<SampleType>(0.0));
 }
 
 template<class SampleType> AudioPluginAudioProcessorWrapper<SampleType>::~AudioPluginAudioProcessorWrapper()
 {
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    designService->stop();
+#endif
 }
 
 template <typename SampleType>
@@ -165,23 +86,109 @@ void AudioPluginAudioProcessorWrapper<SampleType>::prepare(juce::dsp::ProcessSpe
 
     sampleRate = spec.sampleRate;
 
-    // oversamplingFactor = 1 << curOS;
-    // prevOS = curOS;
+    // With re-blocking, nothing below sees a block longer than reblockSize.
+    auto blockSpec = spec;
 
-    // for (int i = 0; i < 5; ++i)
-    //     oversampler[i]->initProcessing(spec.maximumBlockSize);
+    if (reblockSize > 0)
+        blockSpec.maximumBlockSize = isReblockFixedLatency ? static_cast<juce::uint32>(reblockSize)
+                                                           : std::min(blockSpec.maximumBlockSize, static_cast<juce::uint32>(reblockSize));
 
-    // for (int i = 0; i < 5; ++i)
-    //     oversampler[i]->numChannels = (size_t)spec.numChannels;
+    // The whole buffer passes through the re-blocker, sidechain and all.
+    const auto numReblockChannels = static_cast<std::size_t>(std::max(audioProcessor.getTotalNumInputChannels(), audioProcessor.getTotalNumOutputChannels()));
 
-    reset(static_cast<SampleType>(0.0));
+    // The oversamplers need the channel count, so they are made here. Their
+    // FIR filters are linear-phase with a whole number of samples of
+    // latency, so that the dry signal can be delayed to match exactly.
+    const auto osFilter = juce::dsp::Oversampling<SampleType>::filterHalfBandFIREquiripple;
+
+    for (std::size_t i = 1; i < 5; ++i)
+    {
+        oversampler[i] = std::make_unique<juce::dsp::Oversampling<SampleType>>(blockSpec.numChannels, i, osFilter, true, true);
+        oversampler[i]->initProcessing(blockSpec.maximumBlockSize);
+    }
 
-    mixer->prepare(spec);
+    // While the governor has the oversampling lowered, the mixer delays the
+    // wet signal by the latency that has been saved; at most all of it.
+    mixer->setMaximumWetDelay(static_cast<int>(std::lround(oversampler[4]->getLatencyInSamples())));
+
+    oversamplingIndex = 0;
+    requestedOversamplingReduction = 0;
+    oversamplingReduction = 0;
+    isChangingOversampling = false;
+    controlRateTier = 0;
+    bandSpec = blockSpec;
+
+    // One job per group of channels, for the offline pool. They are made
+    // here, whether or not a render ever comes, so that switching the
+    // offline quality path on never allocates.
+    constexpr auto groupSize = StoneyDSP::Audio::Biquads<SampleType>::laneGroupSize;
+    const auto numGroups = (static_cast<std::size_t>(bandSpec.numChannels) + groupSize - 1) / groupSize;
+
+    bandGroupJobs.clear();
+
+    for (std::size_t group = 0; group < numGroups; ++group)
+        bandGroupJobs.push_back(std::make_unique<BandGroupJob>(*this));
 
     for(auto& biquad : biquadArray)
-        biquad->prepare(spec);
+        biquad.setTypeCrossfadeTime(0.001 * STONEYDSP_BIQUADS_TYPE_CROSSFADE_TIME);
+
+    // The state of every band and the mixer's buffers share one block, with
+    // each band's filter and cascade side by side in the order they run. It
+    // is only allocated here, and only when it has to grow.
+    std::size_t arenaSize = mixer->getArenaSize(blockSpec);
+
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+        arenaSize += biquadArray[band].getArenaSize(blockSpec) + cascadeArray[band].getArenaSize(blockSpec);
+
+    arenaSize += reblocker.getArenaSize(numReblockChannels, reblockSize, isReblockFixedLatency);
+
+    arena.prepare(arenaSize);
+
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+    {
+        biquadArray[band].prepare(blockSpec, arena);
+        cascadeArray[band].prepare(blockSpec, arena);
+    }
+
+    mixer->prepare(blockSpec, arena);
+    reblocker.prepare(numReblockChannels, reblockSize, isReblockFixedLatency, arena);
+
+    reset(static_cast<SampleType>(0.0));
+
+    numDetectorChannels = std::max(blockSpec.numChannels, static_cast<juce::uint32>(2));
+    envelope->prepare({ spec.sampleRate, blockSpec.maximumBlockSize, numDetectorChannels });
+
+    bandSampleRate.fill(sampleRate);
+    bandWasActive.fill(false);
+
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    // Anything still queued was designed for the old sample rate.
+    designService->stop();
+    designService->clear();
+    designChangesType.fill(false);
+    designRampLength = static_cast<int>(sampleRate * 0.005);
+#endif
+
+    snapshotVersion = parameters.getVersion();
+    parameters.getSnapshot(snapshot);
+    applySnapshot(true);
 
-    update();
+    // Designs the first kernel from the sections just sent, and picks the
+    // kernel length (and so the latency) for the sample rate.
+    linearPhase->prepare(blockSpec);
+    updateLatency(true);
+
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+    updateCoefficientTables();
+#endif
+
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    designService->start();
+#endif
+
+    // Nothing may go to the heap from here on, until the message thread
+    // prepares or switches this wrapper again.
+    numAllocations = getNumAllocations();
 }
 
 template <typename SampleType>
@@ -190,30 +197,105 @@ void AudioPluginAudioProcessorWrapper<SampleType>::reset()
     SampleType initialValue = static_cast<SampleType>(0.0);
 
     mixer->reset();
+    envelope->reset();
 
     for(auto& biquad : biquadArray)
-        biquad->reset(initialValue);
+        biquad.reset(initialValue);
 
-    // for (int i = 0; i < 5; ++i)
-    //     oversampler[i]->reset();
+    for(auto& cascade : cascadeArray)
+        cascade.reset();
+
+    linearPhase->reset();
+    reblocker.reset();
+
+    for (auto& os : oversampler)
+        if (os != nullptr)
+            os->reset();
 }
 
 template <typename SampleType>
 void AudioPluginAudioProcessorWrapper<SampleType>::reset(SampleType initialValue)
 {
     mixer->reset();
+    envelope->reset();
 
     for(auto& biquad : biquadArray)
-        biquad->reset(initialValue);
+        biquad.reset(initialValue);
+
+    for(auto& cascade : cascadeArray)
+        cascade.reset();
+
+    linearPhase->reset();
+    reblocker.reset();
+
+    for (auto& os : oversampler)
+        if (os != nullptr)
+            os->reset();
+}
+
+template <typename SampleType>
+template <typename OtherSampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::copyStateFrom(const AudioPluginAudioProcessorWrapper<OtherSampleType>& other) noexcept
+{
+    jassert(sampleRate == other.sampleRate);
 
-    // for (int i = 0; i < 5; ++i)
-    //     oversampler[i]->reset();
+    // Works from the same snapshot as the other, so that the same bands are
+    // active, at the same rates and in the same order, before their state
+    // comes across. A parameter change that the other hasn't seen yet is
+    // picked up by the next update().
+    snapshot = other.snapshot;
+    snapshotVersion = other.snapshotVersion;
+
+    requestedOversamplingReduction = other.requestedOversamplingReduction;
+    oversamplingReduction = other.oversamplingReduction;
+    isChangingOversampling = other.isChangingOversampling;
+    controlRateTier = other.controlRateTier;
+
+    isOfflineQuality = other.isOfflineQuality;
+    offlinePool = other.offlinePool;
+
+    applySnapshot(true);
+
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+    {
+        biquadArray[band].copyStateFrom(other.biquadArray[band]);
+        cascadeArray[band].copyStateFrom(other.cascadeArray[band]);
+    }
+
+    mixer->copyStateFrom(*other.mixer);
+    reblocker.copyStateFrom(other.reblocker);
+
+    lfoPhase = other.lfoPhase;
+    transportBpm = other.transportBpm;
+
+    morphPosition = static_cast<SampleType>(other.morphPosition);
+    morphTarget = static_cast<SampleType>(other.morphTarget);
+    morphStep = static_cast<SampleType>(other.morphStep);
+    morphSamplesRemaining = other.morphSamplesRemaining;
+    morphNeedsUpdate = other.morphNeedsUpdate;
+    wasMorphing = other.wasMorphing;
+
+    numAllocations = getNumAllocations();
 }
 
 //==============================================================================
 template <typename SampleType>
 void AudioPluginAudioProcessorWrapper<SampleType>::process(juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages)
 {
+    // For tiny blocks, once nothing is changing, the per-block work below
+    // costs more than the filtering itself.
+    if (isTinyBlockReady && buffer.getNumSamples() <= maxTinyBlockSize && parameters.getVersion() == snapshotVersion)
+    {
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+        // Designs can come back on any block; one that does starts a glide.
+        if (! collectDesigns())
+#endif
+        {
+            processTinyBlock(buffer);
+            return;
+        }
+    }
+
     auto totalNumInputChannels  = audioProcessor.getTotalNumInputChannels();
     auto totalNumOutputChannels = audioProcessor.getTotalNumOutputChannels();
     auto numSamples = buffer.getNumSamples();
@@ -241,9 +323,18 @@ void AudioPluginAudioProcessorWrapper<SampleType>::process(juce::AudioBuffer<Sam
     }
 
     // setOversampling();
-    update();
+    updateTransport();
+
+    // Parameter changes are picked up at the start of each re-blocked block;
+    // with the FIFO, one host block may hold the end of one and the start of
+    // the next.
+    reblocker.process(buffer, [this, &midiMessages](juce::AudioBuffer<SampleType>& block)
+    {
+        update();
+        processBlock(block, midiMessages);
+    });
 
-    processBlock(buffer, midiMessages);
+    updateTinyBlockPath();
     return;
 }
 
@@ -252,11 +343,58 @@ void AudioPluginAudioProcessorWrapper<SampleType>::processBlock(juce::AudioBuffe
 {
     juce::ignoreUnused(midiMessages);
 
-    juce::dsp::AudioBlock<SampleType> dryBlock(buffer);
-    juce::dsp::AudioBlock<SampleType> wetBlock(buffer);
+    // Only the main bus is filtered; any sidechain channels follow it in the
+    // buffer and are only listened to.
+    auto mainBuffer = audioProcessor.getBusBuffer(buffer, false, 0);
+
+    // Everything the bands and the mixer need was made room for in prepare().
+    jassert(getNumAllocations() == numAllocations);
+
+    juce::dsp::AudioBlock<SampleType> dryBlock(mainBuffer);
+    juce::dsp::AudioBlock<SampleType> wetBlock(mainBuffer);
 
     mixer->pushDrySamples(dryBlock);
 
+    if (isLinearPhase)
+    {
+        auto context = juce::dsp::ProcessContextReplacing<SampleType> (wetBlock);
+
+        linearPhase->process(context);
+
+        mixer->mixWetSamples(wetBlock);
+        return;
+    }
+
+    if (numModulatedBands > 0)
+    {
+        // The dynamic bands follow the sidechain if the host has connected
+        // one, or else the main input. Both are read a control block at a
+        // time, before that block is filtered.
+        const bool hasSidechain = audioProcessor.getBusCount(true) > 1 && audioProcessor.getChannelCountOfBus(true, 1) > 0;
+        auto detectorBuffer = audioProcessor.getBusBuffer(buffer, true, hasSidechain ? 1 : 0);
+
+        juce::dsp::AudioBlock<SampleType> detectorBlock(detectorBuffer);
+
+        const auto numSamples = wetBlock.getNumSamples();
+
+        const auto controlInterval = isOfflineQuality ? std::size_t { 1 } : controlBlockSize << controlRateTier;
+
+        for (std::size_t start = 0; start < numSamples; start += controlInterval)
+        {
+            const auto length = std::min(controlInterval, numSamples - start);
+
+            updateModulatedBands(detectorBlock.getSubBlock(start, length));
+
+            auto subBlock = wetBlock.getSubBlock(start, length);
+            auto subContext = juce::dsp::ProcessContextReplacing<SampleType> (subBlock);
+
+            processBands(subContext);
+        }
+
+        mixer->mixWetSamples(wetBlock);
+        return;
+    }
+
     // wetBlock = oversampler[curOS]->processSamplesUp(dryBlock);
 
     // This context is intended for use in situations where two different blocks
@@ -265,8 +403,7 @@ void AudioPluginAudioProcessorWrapper<SampleType>::processBlock(juce::AudioBuffe
     // its results to the block returned by getOutputBlock().
     auto context = juce::dsp::ProcessContextReplacing<SampleType> (wetBlock);
 
-    for(auto& biquad : biquadArray)
-        biquad->process(context);
+    processBands(context);
 
     // processContext(context);
 
@@ -321,39 +458,1044 @@ void AudioPluginAudioProcessorWrapper<SampleType>::snapToZero() noexcept
 {
     // mixer->snapToZero(); // ?
 
-    for(auto& biquad : biquadArray)
-        biquad->snapToZero();
+    for (std::size_t i = 0; i < numActiveBands; ++i)
+        biquadArray[activeBands[i]].snapToZero();
 }
 
 template <typename SampleType>
 void AudioPluginAudioProcessorWrapper<SampleType>::update()
 {
-    mixer->setWetMixProportion(static_cast   <SampleType>    (0.01f * masterMixPtr->get()));
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    // Designs can come back on any block, changed parameters or not.
+    collectDesigns();
+#endif
 
-    for(auto& biquad : biquadArray)
-        biquad->setTransformType(static_cast   <StoneyDSP::Audio::BiquadsBiLinearTransformationType>  (masterTransformPtr->getIndex()));
+    if (isChangingOversampling || requestedOversamplingReduction != oversamplingReduction)
+        updateQuality();
 
-    biquadArray[0]->setFrequency     (static_cast   <SampleType>                                           (biquadsAFrequencyPtr->get()));
-    biquadArray[0]->setResonance     (static_cast   <SampleType>                                           (biquadsAResonancePtr->get()));
-    biquadArray[0]->setGain          (static_cast   <SampleType>                                           (biquadsAGainPtr->get()));
-    biquadArray[0]->setFilterType    (static_cast   <StoneyDSP::Audio::BiquadsFilterType>                  (biquadsATypePtr->getIndex()));
+    const auto currentVersion = parameters.getVersion();
+
+    if (currentVersion == snapshotVersion)
+        return;
+
+    snapshotVersion = currentVersion;
+    parameters.getSnapshot(snapshot);
+    applySnapshot(false);
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::applySnapshot(bool designOnThisThread)
+{
+    // Tiny blocks take the full path until one has seen the new snapshot through.
+    isTinyBlockReady = false;
+
+    // The wet signal stays mixed out while the governor changes oversampling.
+    mixer->setWetMixProportion(static_cast   <SampleType>    (isChangingOversampling ? 0.0f : 0.01f * snapshot.mix));
+
+    const auto transformType = static_cast<StoneyDSP::Audio::BiquadsBiLinearTransformationType>(snapshot.transform);
+    const bool isPreparing = designOnThisThread;
+
+    // A new design method changes every band at once. A new topology leaves
+    // the coefficients alone, and each band carries its state across.
+    const auto newDesignMethod = static_cast<StoneyDSP::Audio::BiquadsDesignMethod>(snapshot.design);
+    const bool designMethodChanged = newDesignMethod != designMethod;
+    designMethod = newDesignMethod;
+
+    if (designMethodChanged || isOfflineQuality)
+        designOnThisThread = true;
+
+#if ! STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+    designOnThisThread = true;
+#endif
+
+    // The bands sit idle in linear-phase mode, so they start again from a
+    // clean state on the way back, as does the convolution on the way in.
+    const bool wasLinearPhase = isLinearPhase;
+    isLinearPhase = snapshot.phase == 1;
+
+    if (isLinearPhase && ! wasLinearPhase)
+        linearPhase->reset();
+
+    if (wasLinearPhase && ! isLinearPhase)
+        bandWasActive.fill(false);
+
+    numPendingSections = 0;
+
+    // Each active band runs at the base rate or at the "Oversampling" rate,
+    // as its own setting asks; linear-phase mode is never oversampled. The
+    // bands are moved before the morph is designed, as it designs for them.
+    // The governor may have taken the factor down by a halving or more; the
+    // offline quality path takes it right up.
+    const auto parameterOversamplingIndex = isLinearPhase ? 0 : isOfflineQuality ? 4 : juce::jlimit(0, 4, snapshot.os);
+    const auto newOversamplingIndex = std::max(0, parameterOversamplingIndex - oversamplingReduction);
+    const auto oversampledRate = sampleRate * static_cast<double>(1 << newOversamplingIndex);
+
+    std::array<bool, biquadArraySize> bandIsOversampled {};
+    std::array<bool, biquadArraySize> bandRateChanged {};
+    bool anyRateChanged = false;
+    bool anyOversampling = false;
+
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+    {
+        const auto& bandSnapshot = snapshot.bands[band];
+
+        if (bandSnapshot.bypass)
+            continue;
+
+        bandIsOversampled[band] = newOversamplingIndex > 0 && (isOfflineQuality ? bandSnapshot.os != 0 : isOversampledBand(band, bandSnapshot));
+        anyOversampling = anyOversampling || bandSnapshot.os != 0;
+
+        const auto newRate = bandIsOversampled[band] ? oversampledRate : sampleRate;
+
+        if (newRate != bandSampleRate[band])
+        {
+            prepareBand(band, newRate);
+            bandRateChanged[band] = true;
+            anyRateChanged = true;
+        }
+    }
 
-    biquadArray[1]->setFrequency     (static_cast   <SampleType>                                           (biquadsBFrequencyPtr->get()));
-    biquadArray[1]->setResonance     (static_cast   <SampleType>                                           (biquadsBResonancePtr->get()));
-    biquadArray[1]->setGain          (static_cast   <SampleType>                                           (biquadsBGainPtr->get()));
-    biquadArray[1]->setFilterType    (static_cast   <StoneyDSP::Audio::BiquadsFilterType>                  (biquadsBTypePtr->getIndex()));
+    // The resampling runs whenever any band may be oversampled, even while
+    // none is, so that the latency doesn't jump as "Auto" bands come and go.
+    const auto lastOversamplingIndex = oversamplingIndex;
+    oversamplingIndex = anyOversampling ? newOversamplingIndex : 0;
+    requestedOversamplingIndex = anyOversampling ? parameterOversamplingIndex : 0;
 
-    biquadArray[2]->setFrequency     (static_cast   <SampleType>                                           (biquadsCFrequencyPtr->get()));
-    biquadArray[2]->setResonance     (static_cast   <SampleType>                                           (biquadsCResonancePtr->get()));
-    biquadArray[2]->setGain          (static_cast   <SampleType>                                           (biquadsCGainPtr->get()));
-    biquadArray[2]->setFilterType    (static_cast   <StoneyDSP::Audio::BiquadsFilterType>                  (biquadsCTypePtr->getIndex()));
+    if (oversamplingIndex > 0 && oversamplingIndex != lastOversamplingIndex)
+        oversampler[oversamplingIndex]->reset();
 
-    biquadArray[3]->setFrequency     (static_cast   <SampleType>                                           (biquadsDFrequencyPtr->get()));
-    biquadArray[3]->setResonance     (static_cast   <SampleType>                                           (biquadsDResonancePtr->get()));
-    biquadArray[3]->setGain          (static_cast   <SampleType>                                           (biquadsDGainPtr->get()));
-    biquadArray[3]->setFilterType    (static_cast   <StoneyDSP::Audio::BiquadsFilterType>                  (biquadsDTypePtr->getIndex()));
+    envelope->setAttackTime  (static_cast   <SampleType>    (snapshot.attack));
+    envelope->setReleaseTime (static_cast   <SampleType>    (snapshot.release));
+
+    if (snapshot.morphing)
+    {
+        if (isPreparing || designMethodChanged || anyRateChanged || snapshot.morphVersion != morphVersion)
+        {
+            morphVersion = snapshot.morphVersion;
+            prepareMorph();
+        }
+
+        const auto target = static_cast<SampleType>(0.01f * snapshot.morph);
+
+        // Glides over 20 ms, a control block at a time; a morph that has only
+        // just been switched on starts from wherever the parameter already is.
+        // In linear-phase mode the kernel's crossfade does the gliding.
+        if (isPreparing || ! wasMorphing || isLinearPhase)
+        {
+            morphPosition = target;
+            morphSamplesRemaining = 0;
+        }
+        else if (target != morphTarget)
+        {
+            morphSamplesRemaining = std::max(1, static_cast<int>(sampleRate * 0.02));
+            morphStep = (target - morphPosition) / static_cast<SampleType>(morphSamplesRemaining);
+        }
+
+        morphTarget = target;
+        morphNeedsUpdate = true;
+    }
+
+    wasMorphing = snapshot.morphing;
+
+    numActiveBands = 0;
+    numModulatedBands = 0;
+    numDynamicBands = 0;
+
+    std::array<std::size_t, biquadArraySize> oversampledBands {};
+    std::size_t numOversampledBands = 0;
+
+    // Switched-off bands are skipped entirely; a band that is switched back on
+    // starts again from a clean state rather than its stale one.
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+    {
+        const auto& bandSnapshot = snapshot.bands[band];
+        const bool isActive = ! bandSnapshot.bypass;
+        const bool isModulated = bandSnapshot.dynamic || bandSnapshot.lfoDepth > 0.0f || snapshot.morphing;
+        bool isCascade = false;
+
+        if (isActive)
+        {
+            auto& biquad = biquadArray[band];
+
+            if (! bandWasActive[band])
+                biquad.reset(static_cast<SampleType>(0.0));
+
+            auto designSnapshot = bandSnapshot;
+
+            if (snapshot.morphing)
+                getMorphedBand(band, designSnapshot);
+
+            // Steep LP/HP bands run through their cascade, which always
+            // designs here; it is only a handful of sections.
+            isCascade = isCascadeBand(designSnapshot);
+
+            if (isCascade)
+            {
+                if (! bandIsCascade[band] || ! bandWasActive[band])
+                    cascadeArray[band].reset();
+
+                updateCascade(band, designSnapshot, static_cast<SampleType>(designSnapshot.frequency));
+            }
+            else if (bandIsCascade[band])
+            {
+                biquad.reset(static_cast<SampleType>(0.0));
+            }
+
+            // Modulated bands re-design every control block from the terms
+            // of the last full design, so they only need one here when they
+            // have just become modulated; a band that has just stopped being
+            // modulated (or steep) always designs here, too.
+            const bool designHere = bandRateChanged[band]
+                                 || (isModulated ? (isPreparing || ! bandWasModulated[band] || bandIsCascade[band])
+                                                 : (designOnThisThread || bandWasModulated[band] || bandIsCascade[band]));
+
+            biquad.setTransformType(transformType);
+            biquad.setDesignMethod(designMethod);
+
+            if (designHere && ! isCascade)
+            {
+                biquad.setParameters     (static_cast   <StoneyDSP::Audio::BiquadsFilterType>                  (designSnapshot.type),
+                                          static_cast   <SampleType>                                           (designSnapshot.frequency),
+                                          static_cast   <SampleType>                                           (designSnapshot.resonance),
+                                          static_cast   <SampleType>                                           (designSnapshot.gain));
+
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+                auto& designed      = designedSettings[band];
+                designed.type       = static_cast<StoneyDSP::Audio::BiquadsFilterType>(designSnapshot.type);
+                designed.frequency  = static_cast<SampleType>(designSnapshot.frequency);
+                designed.resonance  = static_cast<SampleType>(designSnapshot.resonance);
+                designed.gain       = static_cast<SampleType>(designSnapshot.gain);
+                designed.sampleRate = bandSampleRate[band];
+                designed.method     = designMethod;
+                designChangesType[band] = false;
+
+                // Supersedes any design still on its way, for an old rate,
+                // method or setting, which would otherwise be collected over
+                // this one and then never replaced.
+                designService->request(band, designed);
+#endif
+            }
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+            else if (! isModulated && ! isCascade)
+            {
+                requestDesign(band, bandSnapshot);
+            }
+#endif
+
+            if (isLinearPhase)
+                addLinearPhaseSections(band, designSnapshot);
+
+            if (bandIsOversampled[band])
+                oversampledBands[numOversampledBands++] = band;
+            else
+                activeBands[numActiveBands++] = band;
+
+            if (isModulated)
+                modulatedBands[numModulatedBands++] = band;
+
+            if (bandSnapshot.dynamic)
+                ++numDynamicBands;
+        }
+
+        bandWasActive[band] = isActive;
+        bandWasModulated[band] = isActive && isModulated;
+        bandIsCascade[band] = isActive && isCascade;
+    }
+
+    // The oversampled group runs after the base-rate bands.
+    numBaseRateBands = numActiveBands;
+
+    for (std::size_t i = 0; i < numOversampledBands; ++i)
+        activeBands[numActiveBands++] = oversampledBands[i];
+
+    // Stereo modes: 0 is "Linked", 1 is "Mid/Side", 2 is "Left/Right". The
+    // mid/side matrix rides along with the first and last bands.
+    for (std::size_t i = 0; i < numActiveBands; ++i)
+    {
+        const auto channel = snapshot.stereo == 0 ? 0 : snapshot.bands[activeBands[i]].channel;
+
+        activeBandFlags[i] = channel == 1 ? StoneyDSP::Audio::filterFirstChannel
+                           : channel == 2 ? StoneyDSP::Audio::filterSecondChannel
+                                          : StoneyDSP::Audio::filterBothChannels;
+    }
+
+    if (snapshot.stereo == 1 && numActiveBands > 0)
+    {
+        activeBandFlags[0] |= StoneyDSP::Audio::encodeMidSide;
+        activeBandFlags[numActiveBands - 1] |= StoneyDSP::Audio::decodeMidSide;
+    }
+
+    if (isLinearPhase)
+    {
+        const auto isSameSection = [](const StoneyDSP::Audio::BiquadsCoefficients<SampleType>& first, const StoneyDSP::Audio::BiquadsCoefficients<SampleType>& second)
+        {
+            return first.b0 == second.b0 && first.b1 == second.b1 && first.b2 == second.b2 && first.a1 == second.a1 && first.a2 == second.a2;
+        };
+
+        // Only a change to the bands themselves needs a new kernel.
+        const bool isUnchanged = wasLinearPhase && ! isPreparing
+                              && numPendingSections == numLinearPhaseSections
+                              && std::equal(pendingSections.begin(), pendingSections.begin() + static_cast<std::ptrdiff_t>(numPendingSections), linearPhaseSections.begin(), isSameSection);
+
+        if (! isUnchanged)
+        {
+            linearPhaseSections = pendingSections;
+            numLinearPhaseSections = numPendingSections;
+            linearPhase->setSections(linearPhaseSections.data(), numLinearPhaseSections);
+        }
+    }
+
+    updateLatency(false);
+
+    // Only a snapshot applied on the message thread may go to the heap (a
+    // band's first type crossfade, or a new channel count); one applied on
+    // the audio thread must find everything where prepare(), copyStateFrom()
+    // or setOfflineQuality() left it.
+    jassert(isPreparing || getNumAllocations() == numAllocations);
+}
+
+template <typename SampleType>
+int AudioPluginAudioProcessorWrapper<SampleType>::getNumAllocations() const noexcept
+{
+    auto count = arena.getNumAllocations();
+
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+        count += biquadArray[band].getNumAllocations() + cascadeArray[band].getNumAllocations();
+
+    return count;
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::processBands(const juce::dsp::ProcessContextReplacing<SampleType>& context) noexcept
+{
+    processBandRange(context, 0, numBaseRateBands);
+
+    if (oversamplingIndex == 0)
+        return;
+
+    // The bands are in series, so the oversampled group can simply run after
+    // the rest; the whole chain shares the one resampling delay.
+    auto& os = *oversampler[oversamplingIndex];
+    auto& block = context.getOutputBlock();
+    auto upBlock = os.processSamplesUp(block);
+
+    processBandRange(juce::dsp::ProcessContextReplacing<SampleType>(upBlock), numBaseRateBands, numActiveBands);
+
+    os.processSamplesDown(block);
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::processBandRange(const juce::dsp::ProcessContextReplacing<SampleType>& context, std::size_t first, std::size_t last) noexcept
+{
+    if (offlinePool != nullptr && processBandRangeInParallel(context, first, last))
+        return;
+
+    // The stereo modes only mean anything on a stereo bus.
+    const bool isSplit = snapshot.stereo != 0 && context.getOutputBlock().getNumChannels() == 2;
+
+    for (std::size_t i = first; i < last; ++i)
+    {
+        const auto band = activeBands[i];
+        const bool isStereo = isSplit && activeBandFlags[i] != StoneyDSP::Audio::filterBothChannels;
+
+        if (bandIsCascade[band])
+        {
+            auto& cascade = cascadeArray[band];
+
+            if (isStereo)
+                cascade.processStereo(context, activeBandFlags[i]);
+            else
+                cascade.process(context);
+        }
+        else
+        {
+            auto& biquad = biquadArray[band];
+
+            if (isStereo)
+                biquad.processStereo(context, activeBandFlags[i]);
+            else
+                biquad.process(context);
+        }
+    }
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::processTinyBlock(juce::AudioBuffer<SampleType>& buffer) noexcept
+{
+    // The main bus comes first in the buffer.
+    const auto numChannels = std::min(static_cast<std::size_t>(buffer.getNumChannels()), static_cast<std::size_t>(bandSpec.numChannels));
+
+    mixer->processInPlace(buffer.getArrayOfWritePointers(), numChannels, static_cast<std::size_t>(buffer.getNumSamples()), [this](std::size_t channel, SampleType sample)
+    {
+        for (std::size_t i = 0; i < numActiveBands; ++i)
+        {
+            const auto band = activeBands[i];
+
+            sample = bandIsCascade[band] ? cascadeArray[band].processSample(static_cast<int>(channel), sample)
+                                         : biquadArray[band].processSample(static_cast<int>(channel), sample);
+        }
+
+        return sample;
+    });
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::updateTinyBlockPath() noexcept
+{
+    // Unused outputs would need clearing, and the FIFO must see every sample.
+    isTinyBlockReady = audioProcessor.getTotalNumInputChannels() >= audioProcessor.getTotalNumOutputChannels()
+                    && reblocker.getLatencySamples() == 0
+                    && ! isLinearPhase
+                    && oversamplingIndex == 0
+                    && numModulatedBands == 0
+                    && snapshot.stereo == 0
+                    && ! isChangingOversampling
+                    && requestedOversamplingReduction == oversamplingReduction
+                    && mixer->canProcessInPlace();
+
+    for (std::size_t i = 0; i < numActiveBands && isTinyBlockReady; ++i)
+        if (! bandIsCascade[activeBands[i]] && biquadArray[activeBands[i]].isGliding())
+            isTinyBlockReady = false;
+}
+
+template <typename SampleType>
+bool AudioPluginAudioProcessorWrapper<SampleType>::processBandRangeInParallel(const juce::dsp::ProcessContextReplacing<SampleType>& context, std::size_t first, std::size_t last)
+{
+    constexpr auto groupSize = StoneyDSP::Audio::Biquads<SampleType>::laneGroupSize;
+
+    auto& block = context.getOutputBlock();
+    const auto numChannels = block.getNumChannels();
+
+    // The stereo modes only apply to two channels, so never get this far.
+    if (first == last || numChannels <= groupSize || block.getNumSamples() < minParallelBlockSize)
+        return false;
+
+    // A gliding band steps its coefficients once per sample for all of its
+    // channels together.
+    for (std::size_t i = first; i < last; ++i)
+        if (! bandIsCascade[activeBands[i]] && biquadArray[activeBands[i]].isGliding())
+            return false;
+
+    // Each group of channels runs the whole chain of bands on its own
+    // thread; the bands share nothing else between channels.
+    const auto numGroups = (numChannels + groupSize - 1) / groupSize;
+
+    if (numGroups > bandGroupJobs.size())
+        return false;
+
+    for (std::size_t group = 0; group < numGroups; ++group)
+    {
+        auto& job = *bandGroupJobs[group];
+
+        job.firstChannel = group * groupSize;
+        job.groupBlock = block.getSubsetChannelBlock(job.firstChannel, std::min(numChannels - job.firstChannel, static_cast<std::size_t>(groupSize)));
+        job.first = first;
+        job.last = last;
+
+        offlinePool->addJob(&job, false);
+    }
+
+    // Each job is out of the pool again once it has been waited for, ready
+    // for the next block.
+    for (std::size_t group = 0; group < numGroups; ++group)
+        offlinePool->waitForJobToFinish(bandGroupJobs[group].get(), -1);
+
+    return true;
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::processBandGroup(juce::dsp::AudioBlock<SampleType> groupBlock, std::size_t firstChannel, std::size_t first, std::size_t last) noexcept
+{
+    const auto groupContext = juce::dsp::ProcessContextReplacing<SampleType>(groupBlock);
+
+    for (std::size_t i = first; i < last; ++i)
+    {
+        const auto band = activeBands[i];
+
+        if (bandIsCascade[band])
+            cascadeArray[band].processChannels(groupContext, firstChannel);
+        else
+            biquadArray[band].processChannels(groupContext, firstChannel);
+    }
+}
+
+template <typename SampleType>
+bool AudioPluginAudioProcessorWrapper<SampleType>::isOversampledBand(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) const noexcept
+{
+    // "Never", "Always" or "Auto".
+    if (bandSnapshot.os != 2)
+        return bandSnapshot.os == 1;
+
+    // The highest frequency that the band can reach: across the morph (which
+    // takes over the Frequency), and with its LFO at the top of its sweep.
+    auto frequency = bandSnapshot.frequency;
+
+    if (snapshot.morphing)
+    {
+        frequency = snapshot.morphBands[0][band].frequency;
+
+        for (const auto& morphBands : snapshot.morphBands)
+            frequency = std::max(frequency, morphBands[band].frequency);
+    }
+
+    const auto highest = static_cast<double>(frequency) * std::exp2(static_cast<double>(bandSnapshot.lfoDepth));
+
+    return highest > sampleRate * 0.5 * (STONEYDSP_BIQUADS_AUTO_OVERSAMPLING_THRESHOLD / 100.0);
 }
 
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::prepareBand(std::size_t band, double newSampleRate)
+{
+    const auto factor = static_cast<juce::uint32>(newSampleRate / sampleRate + 0.5);
+
+    juce::dsp::ProcessSpec spec { newSampleRate, bandSpec.maximumBlockSize * factor, bandSpec.numChannels };
+
+    biquadArray[band].prepare(spec);
+    cascadeArray[band].prepare(spec);
+    bandSampleRate[band] = newSampleRate;
+}
+
+template <typename SampleType>
+bool AudioPluginAudioProcessorWrapper<SampleType>::isCascadeBand(const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) noexcept
+{
+    const auto type = static_cast<StoneyDSP::Audio::BiquadsFilterType>(bandSnapshot.type);
+
+    return (type == StoneyDSP::Audio::BiquadsFilterType::lowPass2 || type == StoneyDSP::Audio::BiquadsFilterType::highPass2) && bandSnapshot.slope > 0;
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::updateCascade(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot, SampleType frequency) noexcept
+{
+    bool isLinkwitzRiley = false;
+    const auto slope = AudioPluginAudioProcessorParameters::getSlopeDecibels(bandSnapshot.slope, isLinkwitzRiley);
+
+    cascadeArray[band].setParameters(static_cast<StoneyDSP::Audio::BiquadsFilterType>(bandSnapshot.type),
+                                      isLinkwitzRiley ? StoneyDSP::Audio::BiquadsCascadeResponse::linkwitzRiley
+                                                      : StoneyDSP::Audio::BiquadsCascadeResponse::butterworth,
+                                      frequency, slope);
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::updateModulatedBands(const juce::dsp::AudioBlock<SampleType>& detectorBlock) noexcept
+{
+    const auto numSamples = detectorBlock.getNumSamples();
+
+    auto levelDb = static_cast<SampleType>(-120.0);
+
+    if (numDynamicBands > 0)
+    {
+        const auto numChannels = std::min(detectorBlock.getNumChannels(), static_cast<std::size_t>(numDetectorChannels));
+
+        auto level = static_cast<SampleType>(0.0);
+
+        for (std::size_t channel = 0; channel < numChannels; ++channel)
+        {
+            const auto* samples = detectorBlock.getChannelPointer(channel);
+            auto channelLevel = static_cast<SampleType>(0.0);
+
+            for (std::size_t i = 0; i < numSamples; ++i)
+                channelLevel = envelope->processSample(static_cast<int>(channel), samples[i]);
+
+            level = std::max(level, channelLevel);
+        }
+
+        levelDb = juce::Decibels::gainToDecibels(level, static_cast<SampleType>(-120.0));
+    }
+
+    // ln(2), since 2^octaves == e^(octaves * ln(2))
+    constexpr auto nepersPerOctave = static_cast<SampleType>(0.69314718055994530942);
+
+    // The floor of the Gain parameter, which a dynamic band stops at.
+    const auto minGainDecibels = static_cast<SampleType>(AudioPluginAudioProcessorParameters::getMinGainDecibels());
+
+    if (morphSamplesRemaining > 0)
+    {
+        const auto numSteps = std::min(morphSamplesRemaining, static_cast<int>(numSamples));
+
+        morphSamplesRemaining -= numSteps;
+        morphPosition = morphSamplesRemaining > 0 ? morphPosition + morphStep * static_cast<SampleType>(numSteps) : morphTarget;
+        morphNeedsUpdate = true;
+    }
+
+    for (std::size_t i = 0; i < numModulatedBands; ++i)
+    {
+        const auto band = modulatedBands[i];
+        auto bandSnapshot = snapshot.bands[band];
+        const bool isSwept = bandSnapshot.dynamic || bandSnapshot.lfoDepth > 0.0f;
+
+        // A band that is only morphed has nothing to do while the morph rests.
+        if (! isSwept && ! morphNeedsUpdate)
+            continue;
+
+        const auto morphedSnapshot = snapshot.morphing ? getMorphedBand(band, bandSnapshot) : -1;
+
+        auto frequency = static_cast<SampleType>(bandSnapshot.frequency);
+        auto gain = static_cast<SampleType>(bandSnapshot.gain);
+
+        if (bandSnapshot.lfoDepth > 0.0f)
+        {
+            // Sweeps +/- depth octaves around the Frequency parameter.
+            const auto octaves = static_cast<SampleType>(bandSnapshot.lfoDepth) * getLfoValue(bandSnapshot.lfoShape, lfoPhase[band]);
+            frequency = frequency * StoneyDSP::Maths::Functions<SampleType>::exp(octaves * nepersPerOctave);
+
+            const auto syncBeats = AudioPluginAudioProcessorParameters::getLfoSyncBeats(bandSnapshot.lfoSync);
+            const auto cyclesPerSecond = syncBeats > 0.0 ? (transportBpm / 60.0) / syncBeats : static_cast<double>(bandSnapshot.lfoRate);
+
+            lfoPhase[band] += cyclesPerSecond * static_cast<double>(numSamples) / sampleRate;
+            lfoPhase[band] -= std::floor(lfoPhase[band]);
+        }
+
+        if (bandSnapshot.dynamic)
+        {
+            // Downward, above the threshold only: the band's gain falls by
+            // (1 - 1 / ratio) dB for every dB that the envelope is over...
+            const auto over = std::max(static_cast<SampleType>(0.0), levelDb - static_cast<SampleType>(bandSnapshot.threshold));
+            const auto slope = static_cast<SampleType>(1.0) - static_cast<SampleType>(1.0) / static_cast<SampleType>(bandSnapshot.ratio);
+
+            // ...but no further than the Gain parameter itself can go.
+            gain = std::max(minGainDecibels, gain - (over * slope));
+        }
+
+        if (bandIsCascade[band])
+        {
+            updateCascade(band, bandSnapshot, frequency);
+            continue;
+        }
+
+        auto& biquad = biquadArray[band];
+        const auto type = static_cast<StoneyDSP::Audio::BiquadsFilterType>(bandSnapshot.type);
+
+        // The morph may have crossed a change of type, which needs a full design.
+        if (biquad.getFilterType() != type)
+            biquad.setFilterType(type);
+
+        if (morphedSnapshot >= 0 && ! isSwept)
+            biquad.setCoefficients(morphCoefficients[static_cast<std::size_t>(morphedSnapshot)][band]);
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+        else if (const auto* table = getCoefficientTable(band))
+            biquad.setCoefficients(table->getLinear(frequency));
+#endif
+        else
+            biquad.setParametersFast(frequency, static_cast<SampleType>(bandSnapshot.resonance), gain);
+    }
+
+    morphNeedsUpdate = false;
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::addLinearPhaseSections(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) noexcept
+{
+    // The kernel follows each band's settings as they stand; the dynamics,
+    // the LFOs and the stereo modes only apply at minimum phase.
+    if (isCascadeBand(bandSnapshot))
+    {
+        const auto& cascade = cascadeArray[band];
+
+        for (int i = 0; i < cascade.getNumSections(); ++i)
+            pendingSections[numPendingSections++] = cascade.getSection(i);
+
+        return;
+    }
+
+    pendingSections[numPendingSections++] = StoneyDSP::Audio::Biquads<SampleType>::calculateCoefficients
+                                         (static_cast   <StoneyDSP::Audio::BiquadsFilterType>                  (bandSnapshot.type),
+                                          static_cast   <SampleType>                                           (bandSnapshot.frequency),
+                                          static_cast   <SampleType>                                           (bandSnapshot.resonance),
+                                          static_cast   <SampleType>                                           (bandSnapshot.gain),
+                                          sampleRate,
+                                          designMethod);
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::updateLatency(bool force) noexcept
+{
+    const auto getOversamplingLatency = [this](int index)
+    {
+        return index > 0 ? static_cast<int>(std::lround(oversampler[index]->getLatencyInSamples())) : 0;
+    };
+
+    auto newLatency = 0;
+    auto newWetDelay = 0;
+
+    // The host is told the latency of the oversampling that the parameters
+    // ask for; while the governor has it lowered, the wet signal is delayed
+    // by the difference.
+    if (isLinearPhase)
+    {
+        newLatency = linearPhase->getLatencySamples();
+    }
+    else
+    {
+        newLatency = getOversamplingLatency(requestedOversamplingIndex);
+        newWetDelay = newLatency - getOversamplingLatency(oversamplingIndex);
+    }
+
+    if (newLatency == latencySamples && newWetDelay == wetDelaySamples && ! force)
+        return;
+
+    // The dry signal is delayed to match, for the Mix control.
+    latencySamples = newLatency;
+    wetDelaySamples = newWetDelay;
+    mixer->setWetLatency(latencySamples);
+    mixer->setWetDelay(wetDelaySamples);
+    audioProcessor.setLatencySamples(latencySamples + reblocker.getLatencySamples());
+}
+
+template <typename SampleType>
+SampleType AudioPluginAudioProcessorWrapper<SampleType>::getLatencySamples() const noexcept
+{
+    return static_cast<SampleType>(latencySamples);
+}
+
+template <typename SampleType>
+int AudioPluginAudioProcessorWrapper<SampleType>::getNumQualityTiers(bool canLowerPrecision) const noexcept
+{
+    const auto precisionTiers = canLowerPrecision && ! isLinearPhase ? 1 : 0;
+
+    return requestedOversamplingIndex + precisionTiers + numControlRateTiers;
+}
+
+template <typename SampleType>
+bool AudioPluginAudioProcessorWrapper<SampleType>::setQualityTier(int tier, bool canLowerPrecision) noexcept
+{
+    const auto precisionTiers = canLowerPrecision && ! isLinearPhase ? 1 : 0;
+    const auto newTier = juce::jlimit(0, getNumQualityTiers(canLowerPrecision), tier);
+
+    requestedOversamplingReduction = std::min(newTier, requestedOversamplingIndex);
+    controlRateTier = juce::jlimit(0, numControlRateTiers, newTier - requestedOversamplingIndex - precisionTiers);
+
+    if (requestedOversamplingReduction != oversamplingReduction)
+        isTinyBlockReady = false;
+
+    return precisionTiers > 0
+        && newTier > requestedOversamplingIndex
+        && ! isChangingOversampling
+        && requestedOversamplingReduction == oversamplingReduction;
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::setOfflineQuality(bool shouldUseOfflineQuality, juce::ThreadPool* pool)
+{
+    offlinePool = shouldUseOfflineQuality ? pool : nullptr;
+
+    if (shouldUseOfflineQuality == isOfflineQuality)
+        return;
+
+    // Moves the bands to their new rates, and designs every one of them here.
+    isOfflineQuality = shouldUseOfflineQuality;
+    applySnapshot(true);
+
+    numAllocations = getNumAllocations();
+}
+
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::updateCoefficientTables()
+{
+    using tableType = StoneyDSP::Audio::BiquadsCoefficientTable<SampleType>;
+
+    struct TableSettings
+    {
+        bool isWanted = false;
+        StoneyDSP::Audio::BiquadsFilterType type = StoneyDSP::Audio::BiquadsFilterType::peak;
+        SampleType resonance {}, gain {};
+        double sampleRate = 0.0;
+    };
+
+    std::array<std::shared_ptr<const tableType>, biquadArraySize> tables;
+    std::array<TableSettings, biquadArraySize> settings {};
+    std::array<bool, biquadArraySize> isChanged {};
+
+    // The audio thread is only held off while the settings are read...
+    {
+        const juce::ScopedLock lock (audioProcessor.getCallbackLock());
+
+        tables = coefficientTables;
+
+        for (std::size_t band = 0; band < biquadArraySize; ++band)
+        {
+            const auto& bandSnapshot = snapshot.bands[band];
+
+            settings[band] = { isTableBand(band),
+                               static_cast<StoneyDSP::Audio::BiquadsFilterType>(bandSnapshot.type),
+                               static_cast<SampleType>(bandSnapshot.resonance),
+                               static_cast<SampleType>(bandSnapshot.gain),
+                               bandSampleRate[band] };
+        }
+    }
+
+    // ...the tables are built (or shared) without it...
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+    {
+        const auto& wanted = settings[band];
+        const auto* table = tables[band].get();
+
+        if (! wanted.isWanted || wanted.sampleRate <= 0.0)
+        {
+            isChanged[band] = table != nullptr;
+            tables[band] = nullptr;
+            continue;
+        }
+
+        if (table != nullptr && table->getFilterType() == wanted.type && table->getResonance() == wanted.resonance
+         && table->getGain() == wanted.gain && table->getSampleRate() == wanted.sampleRate)
+            continue;
+
+        tables[band] = tableType::getShared(wanted.type, wanted.resonance, wanted.gain, wanted.sampleRate);
+        isChanged[band] = true;
+    }
+
+    // ...and handed over, so that the old ones are let go of here.
+    const juce::ScopedLock lock (audioProcessor.getCallbackLock());
+
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+        if (isChanged[band])
+            std::swap(coefficientTables[band], tables[band]);
+}
+#endif
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::updateQuality() noexcept
+{
+    // The wet signal fades out first...
+    if (! isChangingOversampling)
+    {
+        isChangingOversampling = true;
+        mixer->setWetMixProportion(static_cast<SampleType>(0.0));
+        return;
+    }
+
+    if (mixer->isSmoothing())
+        return;
+
+    // ...then, with only the (delayed) dry signal to be heard, the bands move
+    // to their new rates from a clean state, the wet delay takes up the
+    // latency saved, and the wet signal fades back in. If the governor has
+    // changed its mind in the meantime, it simply fades back in.
+    isChangingOversampling = false;
+
+    if (requestedOversamplingReduction != oversamplingReduction)
+    {
+        oversamplingReduction = requestedOversamplingReduction;
+        applySnapshot(false);
+    }
+    else
+    {
+        mixer->setWetMixProportion(static_cast<SampleType>(0.01f * snapshot.mix));
+    }
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::updateTransport() noexcept
+{
+    auto* playHead = audioProcessor.getPlayHead();
+
+    if (playHead == nullptr)
+        return;
+
+    const auto position = playHead->getPosition();
+
+    if (! position)
+        return;
+
+    if (const auto bpm = position->getBpm())
+        transportBpm = *bpm;
+
+    const auto ppq = position->getPpqPosition();
+
+    if (! position->getIsPlaying() || ! ppq)
+        return;
+
+    // While the host is playing, synced LFOs follow its position exactly.
+    for (std::size_t i = 0; i < numModulatedBands; ++i)
+    {
+        const auto band = modulatedBands[i];
+        const auto syncBeats = AudioPluginAudioProcessorParameters::getLfoSyncBeats(snapshot.bands[band].lfoSync);
+
+        if (syncBeats > 0.0)
+        {
+            const auto cycles = *ppq / syncBeats;
+            lfoPhase[band] = cycles - std::floor(cycles);
+        }
+    }
+}
+
+template <typename SampleType>
+SampleType AudioPluginAudioProcessorWrapper<SampleType>::getLfoValue(int shape, double phase) noexcept
+{
+    constexpr auto pi = juce::MathConstants<SampleType>::pi;
+
+    const auto p = static_cast<SampleType>(phase);
+    const auto one = static_cast<SampleType>(1.0);
+    const auto two = static_cast<SampleType>(2.0);
+    const auto three = static_cast<SampleType>(3.0);
+    const auto four = static_cast<SampleType>(4.0);
+    const auto half = static_cast<SampleType>(0.5);
+
+    switch (shape)
+    {
+    case 1: // Triangle
+        return p < half ? (p * four) - one : three - (p * four);
+
+    case 2: // Saw
+        return (p * two) - one;
+
+    case 3: // Square
+        return p < half ? one : -one;
+
+    default: // Sine; the fast sine is only valid up to pi, so fold the second half over.
+    {
+        SampleType sine, cosine;
+        StoneyDSP::Maths::Functions<SampleType>::sinCos(two * pi * (p < half ? p : p - half), sine, cosine);
+        return p < half ? sine : -sine;
+    }
+    }
+}
+
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::prepareMorph()
+{
+    for (std::size_t slot = 0; slot < numMorphSnapshots; ++slot)
+    {
+        for (std::size_t band = 0; band < biquadArraySize; ++band)
+        {
+            const auto& bandSnapshot = snapshot.morphBands[slot][band];
+
+            morphCoefficients[slot][band] = StoneyDSP::Audio::Biquads<SampleType>::calculateCoefficients
+                                         (static_cast   <StoneyDSP::Audio::BiquadsFilterType>                  (bandSnapshot.type),
+                                          static_cast   <SampleType>                                           (bandSnapshot.frequency),
+                                          static_cast   <SampleType>                                           (bandSnapshot.resonance),
+                                          static_cast   <SampleType>                                           (bandSnapshot.gain),
+                                          bandSampleRate[band],
+                                          designMethod);
+
+            if (slot > 0)
+                morphLogRatio[slot - 1][band] = static_cast<SampleType>(std::log(bandSnapshot.frequency / snapshot.morphBands[slot - 1][band].frequency));
+        }
+    }
+}
+
+template <typename SampleType>
+int AudioPluginAudioProcessorWrapper<SampleType>::getMorphedBand(std::size_t band, AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot) const noexcept
+{
+    const auto position = morphPosition * static_cast<SampleType>(numMorphSnapshots - 1);
+    const auto index = std::min(static_cast<std::size_t>(std::max(position, static_cast<SampleType>(0.0))), numMorphSnapshots - 2);
+    const auto t = position - static_cast<SampleType>(index);
+
+    const auto& from = snapshot.morphBands[index][band];
+    const auto& to = snapshot.morphBands[index + 1][band];
+
+    const auto copyFrom = [&bandSnapshot](const AudioPluginAudioProcessorParameters::BandSnapshot& source)
+    {
+        bandSnapshot.frequency  = source.frequency;
+        bandSnapshot.resonance  = source.resonance;
+        bandSnapshot.gain       = source.gain;
+        bandSnapshot.type       = source.type;
+    };
+
+    if (t <= static_cast<SampleType>(0.0))
+    {
+        copyFrom(from);
+        return static_cast<int>(index);
+    }
+
+    if (t >= static_cast<SampleType>(1.0))
+    {
+        copyFrom(to);
+        return static_cast<int>(index + 1);
+    }
+
+    const auto tf = static_cast<float>(t);
+
+    bandSnapshot.frequency  = static_cast<float>(static_cast<SampleType>(from.frequency) * StoneyDSP::Maths::Functions<SampleType>::exp(t * morphLogRatio[index][band]));
+    bandSnapshot.resonance  = from.resonance + tf * (to.resonance - from.resonance);
+    bandSnapshot.gain       = from.gain + tf * (to.gain - from.gain);
+    bandSnapshot.type       = t < static_cast<SampleType>(0.5) ? from.type : to.type;
+
+    return -1;
+}
+
+#if STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE
+template <typename SampleType>
+bool AudioPluginAudioProcessorWrapper<SampleType>::isTableBand(std::size_t band) const noexcept
+{
+    const auto& bandSnapshot = snapshot.bands[band];
+
+    return ! bandSnapshot.bypass && bandSnapshot.lfoDepth > 0.0f && ! bandSnapshot.dynamic
+        && ! snapshot.morphing && ! isLinearPhase && ! bandIsCascade[band]
+        && designMethod == StoneyDSP::Audio::BiquadsDesignMethod::bilinear;
+}
+
+template <typename SampleType>
+const StoneyDSP::Audio::BiquadsCoefficientTable<SampleType>* AudioPluginAudioProcessorWrapper<SampleType>::getCoefficientTable(std::size_t band) const noexcept
+{
+    const auto* table = coefficientTables[band].get();
+
+    if (table == nullptr || ! isTableBand(band))
+        return nullptr;
+
+    const auto& bandSnapshot = snapshot.bands[band];
+
+    // The message thread may not have caught up with the band's settings yet.
+    const bool isCurrent = table->getFilterType() == static_cast<StoneyDSP::Audio::BiquadsFilterType>(bandSnapshot.type)
+                        && table->getResonance() == static_cast<SampleType>(bandSnapshot.resonance)
+                        && table->getGain() == static_cast<SampleType>(bandSnapshot.gain)
+                        && table->getSampleRate() == bandSampleRate[band];
+
+    return isCurrent ? table : nullptr;
+}
+#endif
+
+#if STONEYDSP_BIQUADS_USING_DESIGN_SERVICE
+template <typename SampleType>
+void AudioPluginAudioProcessorWrapper<SampleType>::requestDesign(std::size_t band, const AudioPluginAudioProcessorParameters::BandSnapshot& bandSnapshot)
+{
+    typename designServiceType::Request request;
+
+    request.type        = static_cast<StoneyDSP::Audio::BiquadsFilterType>(bandSnapshot.type);
+    request.frequency   = static_cast<SampleType>(bandSnapshot.frequency);
+    request.resonance   = static_cast<SampleType>(bandSnapshot.resonance);
+    request.gain        = static_cast<SampleType>(bandSnapshot.gain);
+    request.sampleRate  = bandSampleRate[band];
+    request.method      = designMethod;
+
+    auto& designed = designedSettings[band];
+
+    if (request.type == designed.type && request.frequency == designed.frequency
+     && request.resonance == designed.resonance && request.gain == designed.gain
+     && request.method == designed.method && request.sampleRate == designed.sampleRate)
+        return;
+
+    // The band crossfades to a new filter type when its design arrives, as
+    // Biquads::setFilterType() would.
+    if (request.type != designed.type)
+        designChangesType[band] = true;
+
+    designed = request;
+    designService->request(band, request);
+}
+
+template <typename SampleType>
+bool AudioPluginAudioProcessorWrapper<SampleType>::collectDesigns() noexcept
+{
+    bool hasCollected = false;
+
+    for (std::size_t band = 0; band < biquadArraySize; ++band)
+        if (const auto* coefficients = designService->collect(band))
+        {
+            if (designChangesType[band])
+                biquadArray[band].crossfadeToCoefficients(*coefficients);
+            else
+                biquadArray[band].setCoefficients(*coefficients, designRampLength);
+
+            designChangesType[band] = false;
+            hasCollected = true;
+        }
+
+    return hasCollected;
+}
+#endif
+
 // template <typename SampleType>
 // void AudioPluginAudioProcessorWrapper<SampleType>::setOversampling()
 // {
@@ -367,15 +1509,13 @@ void AudioPluginAudioProcessorWrapper<SampleType>::update()
 //     }
 // }
 
-// template <typename SampleType>
-// SampleType AudioPluginAudioProcessorWrapper<SampleType>::getLatencySamples() const noexcept
-// {
-//     return oversampler[curOS]->getLatencyInSamples();
-// }
 //==============================================================================
 template class AudioPluginAudioProcessorWrapper<float>;
 template class AudioPluginAudioProcessorWrapper<double>;
 
+template void AudioPluginAudioProcessorWrapper<float>::copyStateFrom<double>(const AudioPluginAudioProcessorWrapper<double>&) noexcept;
+template void AudioPluginAudioProcessorWrapper<double>::copyStateFrom<float>(const AudioPluginAudioProcessorWrapper<float>&) noexcept;
+
   /// @} group Biquads
 } // namespace Biquads
 
@@ -0,0 +1,98 @@
+/***************************************************************************//**
+ * @file BatchDesign.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The batch coefficient design against one filter at a time.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "Benchmark.hpp"
+
+#include <vector>
+
+namespace
+{
+    using namespace StoneyDSP;
+    using filterType = Audio::BiquadsFilterType;
+
+    constexpr double sampleRate = 48000.0;
+
+    /**
+     * Designs ```numFilters``` filters of every second-order type in turn,
+     * spread over the audio band, as a preset recall would ask for them; once
+     * a filter at a time, then as one batch. Returns the ns per filter of each.
+     */
+    template <typename SampleType>
+    void run(const char* precision, std::size_t numFilters)
+    {
+        using coefficientsType = Audio::BiquadsCoefficients<SampleType>;
+
+        constexpr filterType secondOrderTypes[] = {
+            filterType::lowPass2, filterType::highPass2, filterType::bandPass, filterType::lowShelf2,
+            filterType::highShelf2, filterType::peak, filterType::notch, filterType::allPass
+        };
+
+        std::vector<filterType> types(numFilters);
+        std::vector<SampleType> frequencies(numFilters), resonances(numFilters), gains(numFilters);
+        std::vector<coefficientsType> coefficients(numFilters);
+
+        for (std::size_t i = 0; i < numFilters; ++i)
+        {
+            const auto position = static_cast<double>(i) / static_cast<double>(numFilters);
+
+            types[i]       = secondOrderTypes[i % std::size(secondOrderTypes)];
+            frequencies[i] = static_cast<SampleType>(20.0 * std::pow(1000.0, position));
+            resonances[i]  = static_cast<SampleType>(0.5);
+            gains[i]       = static_cast<SampleType>(12.0 - (24.0 * position));
+        }
+
+        const auto numCalls = static_cast<int>(std::max(std::size_t { 64 }, 65536 / numFilters));
+
+        const auto singleNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            for (std::size_t i = 0; i < numFilters; ++i)
+                coefficients[i] = Audio::Biquads<SampleType>::calculateCoefficients(types[i], frequencies[i], resonances[i], gains[i], sampleRate);
+
+            Benchmarks::keep(coefficients.back());
+        }, numCalls) / static_cast<double>(numFilters);
+
+        const auto batchNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            Audio::Biquads<SampleType>::calculateCoefficients(types.data(), frequencies.data(), resonances.data(), gains.data(), coefficients.data(), numFilters, sampleRate);
+            Benchmarks::keep(coefficients.back());
+        }, numCalls) / static_cast<double>(numFilters);
+
+        std::printf("%-6s  %7zu  %8.1f  %8.1f  %7.2f\n", precision, numFilters, singleNs, batchNs, singleNs / batchNs);
+    }
+}
+
+int main()
+{
+    std::printf("Designing N filters of mixed second-order types at %.0fHz, one at a time and as one batch;\n", sampleRate);
+    std::printf("ns per filter.\n\n");
+    std::printf("%-6s  %7s  %8s  %8s  %7s\n", "", "filters", "single", "batch", "speedup");
+
+    for (const std::size_t numFilters : { 4, 24, 256 })
+        run<float>("float", numFilters);
+
+    for (const std::size_t numFilters : { 4, 24, 256 })
+        run<double>("double", numFilters);
+
+    return 0;
+}
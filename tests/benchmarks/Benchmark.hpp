@@ -0,0 +1,141 @@
+/***************************************************************************//**
+ * @file Benchmark.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Timing helpers shared by the benchmark programs.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <stoneydsp_audio/stoneydsp_audio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Benchmarks {
+/** @addtogroup Benchmarks @{ */
+
+/**
+ * @brief Calls a function ```numCalls``` times, ```numRuns``` times over, and
+ * returns the time per call of the fastest run, in nanoseconds. The fastest
+ * run is the one least disturbed by the rest of the system.
+ */
+template <typename Function>
+double getNanosecondsPerCall(Function&& function, int numCalls, int numRuns = 7)
+{
+    auto best = std::numeric_limits<double>::max();
+
+    for (int run = 0; run < numRuns; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int call = 0; call < numCalls; ++call)
+            function();
+
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+        best = std::min(best, elapsed.count() / static_cast<double>(numCalls));
+    }
+
+    return best;
+}
+
+/** Keeps a result alive, so that the work that made it is not optimised away. */
+template <typename ValueType>
+void keep(const ValueType& value) noexcept
+{
+#if JUCE_MSVC
+    static const volatile void* sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile ("" : : "r" (&value) : "memory");
+#endif
+}
+
+/** Fills a buffer with the same test signal every time: a sine under noise. */
+template <typename SampleType>
+void fillWithTestSignal(SampleType* samples, std::size_t numSamples, std::size_t offset = 0) noexcept
+{
+    for (std::size_t i = 0; i < numSamples; ++i)
+    {
+        const auto n = static_cast<long long>(offset + i);
+        samples[i] = static_cast<SampleType>(std::sin(0.013 * static_cast<double>(n)) * 0.5 + static_cast<double>((n * 7919) % 17) / 34.0 - 0.25);
+    }
+}
+
+/** Sets a parameter from its real (not normalised) value, as a host would. */
+inline void setParameter(juce::AudioProcessorValueTreeState& apvts, const juce::String& parameterID, float value)
+{
+    auto* parameter = apvts.getParameter(parameterID);
+    jassert(parameter != nullptr);
+
+    parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+}
+
+/**
+ * @brief Returns what a prepared processor costs per sample frame, in
+ * nanoseconds, over blocks of ```blockSize``` samples of the test signal,
+ * on every channel of its current layout. Copying the signal into each block
+ * is counted too; it is the same for every configuration.
+ */
+template <typename SampleType>
+double getNanosecondsPerSample(juce::AudioProcessor& processor, int blockSize, int numSamples = 1 << 16)
+{
+    const auto numChannels = std::max(processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+    const auto numBlocks = std::max(1, numSamples / blockSize);
+
+    juce::AudioBuffer<SampleType> source(numChannels, numBlocks * blockSize);
+    juce::AudioBuffer<SampleType> buffer(numChannels, blockSize);
+    juce::MidiBuffer midiMessages;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        fillWithTestSignal(source.getWritePointer(channel), static_cast<std::size_t>(source.getNumSamples()), static_cast<std::size_t>(channel) * 101);
+
+    const auto processAll = [&]
+    {
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                buffer.copyFrom(channel, 0, source, channel, block * blockSize, blockSize);
+
+            processor.processBlock(buffer, midiMessages);
+        }
+
+        keep(*buffer.getReadPointer(0));
+    };
+
+    // Once to settle the smoothing, the ramps and the first snapshot.
+    processAll();
+
+    return getNanosecondsPerCall(processAll, 1) / static_cast<double>(numBlocks * blockSize);
+}
+
+  /// @} group Benchmarks
+} // namespace Benchmarks
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,117 @@
+/***************************************************************************//**
+ * @file Cascade.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief A steep filter in one pass, against the same sections as separate Biquads.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "Benchmark.hpp"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+    using namespace StoneyDSP;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int numSamples = 1 << 16;
+
+    /**
+     * Returns ns per sample frame of a low-pass at ```slope``` dB/oct, run
+     * as one ```BiquadsCascade``` and as one ```Biquads``` per section, each
+     * in turn over the whole block; the sections are the same either way.
+     */
+    template <typename SampleType>
+    void run(const char* precision, int slope, int numChannels, int blockSize)
+    {
+        using cascadeType = Audio::BiquadsCascade<SampleType>;
+
+        juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels) };
+
+        cascadeType cascade;
+        cascade.prepare(spec);
+        cascade.setParameters(Audio::BiquadsFilterType::lowPass2, Audio::BiquadsCascadeResponse::butterworth, static_cast<SampleType>(1000.0), slope);
+
+        const auto numSections = cascade.getNumSections();
+        std::array<Audio::Biquads<SampleType>, cascadeType::maxSections> biquads;
+
+        for (int i = 0; i < numSections; ++i)
+        {
+            auto& biquad = biquads[static_cast<std::size_t>(i)];
+            biquad.prepare(spec);
+            biquad.setCoefficients(cascade.getSection(i));
+        }
+
+        juce::AudioBuffer<SampleType> source(numChannels, numSamples);
+        juce::AudioBuffer<SampleType> buffer(numChannels, blockSize);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            Benchmarks::fillWithTestSignal(source.getWritePointer(channel), static_cast<std::size_t>(numSamples), static_cast<std::size_t>(channel) * 101);
+
+        const auto measure = [&] (auto&& process)
+        {
+            return Benchmarks::getNanosecondsPerCall([&]
+            {
+                for (int start = 0; start < numSamples; start += blockSize)
+                {
+                    for (int channel = 0; channel < numChannels; ++channel)
+                        buffer.copyFrom(channel, 0, source, channel, start, blockSize);
+
+                    juce::dsp::AudioBlock<SampleType> block(buffer);
+                    process(juce::dsp::ProcessContextReplacing<SampleType>(block));
+                }
+
+                Benchmarks::keep(*buffer.getReadPointer(0));
+            }, 1) / static_cast<double>(numSamples);
+        };
+
+        const auto cascadeNs = measure([&] (const auto& context)
+        {
+            cascade.process(context);
+        });
+
+        const auto biquadsNs = measure([&] (const auto& context)
+        {
+            for (int i = 0; i < numSections; ++i)
+                biquads[static_cast<std::size_t>(i)].process(context);
+        });
+
+        std::printf("%-6s  %5d  %8d  %5d  %8d  %8.2f  %8.2f  %7.2f\n",
+                    precision, slope, numSections, numChannels, blockSize, cascadeNs, biquadsNs, biquadsNs / cascadeNs);
+    }
+}
+
+int main()
+{
+    std::printf("Butterworth low-pass at 1kHz and %.0fHz, as one cascade and as one Biquads per section; ns per sample frame.\n\n", sampleRate);
+    std::printf("%-6s  %5s  %8s  %5s  %8s  %8s  %8s  %7s\n", "", "slope", "sections", "chans", "block", "cascade", "biquads", "speedup");
+
+    for (const auto slope : { 24, 48, 96 })
+        for (const auto numChannels : { 1, 2 })
+            for (const auto blockSize : { 64, 512 })
+                run<float>("float", slope, numChannels, blockSize);
+
+    for (const auto numChannels : { 1, 2 })
+        for (const auto blockSize : { 64, 512 })
+            run<double>("double", 96, numChannels, blockSize);
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/***************************************************************************//**
+ * @file Channels.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The cost per channel, from mono up to 16 channels.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include "Benchmark.hpp"
+
+namespace
+{
+    using namespace StoneyDSP;
+    using Parameters = Biquads::AudioPluginAudioProcessorParameters;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+
+    /** Switches every band on, as peaks spread from 100Hz to 10kHz. */
+    void setBands(juce::AudioProcessorValueTreeState& apvts)
+    {
+        for (std::size_t band = 0; band < Parameters::numBands; ++band)
+        {
+            const auto position = Parameters::numBands > 1 ? static_cast<float>(band) / static_cast<float>(Parameters::numBands - 1) : 0.0f;
+
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "bypass"),    0.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "frequency"), 100.0f * std::pow(100.0f, position));
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "resonance"), 0.5f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "gain"),      6.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "type"),      12.0f);
+        }
+    }
+
+    juce::AudioChannelSet getChannelSet(int numChannels)
+    {
+        if (numChannels == 1)
+            return juce::AudioChannelSet::mono();
+
+        if (numChannels == 2)
+            return juce::AudioChannelSet::stereo();
+
+        return juce::AudioChannelSet::discreteChannels(numChannels);
+    }
+
+    double measure(Biquads::AudioPluginAudioProcessor& processor, int numChannels)
+    {
+        auto layout = processor.getBusesLayout();
+        layout.inputBuses.getReference(0) = getChannelSet(numChannels);
+        layout.outputBuses.getReference(0) = getChannelSet(numChannels);
+
+        const auto isLayoutSet = processor.setBusesLayout(layout);
+        jassert(isLayoutSet);
+        juce::ignoreUnused(isLayoutSet);
+
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        return Benchmarks::getNanosecondsPerSample<float>(processor, blockSize) / static_cast<double>(numChannels);
+    }
+}
+
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    Biquads::AudioPluginAudioProcessor processor;
+    setBands(processor.getApvts());
+
+    std::printf("%d peak bands at %.0fHz in blocks of %d; channels are filtered in lane groups of four from four up.\n",
+                static_cast<int>(Parameters::numBands), sampleRate, blockSize);
+    std::printf("ns per sample, per channel.\n\n");
+    std::printf("%8s  %11s  %7s\n", "channels", "per channel", "/mono");
+
+    // Once to wake the CPU up.
+    measure(processor, 2);
+
+    const auto monoNs = measure(processor, 1);
+
+    // Mono, stereo, quad, 5.1, 7.1, 7.1.2, 7.1.4 and third order ambisonics.
+    for (const auto numChannels : { 1, 2, 4, 6, 8, 10, 12, 16 })
+    {
+        const auto ns = numChannels == 1 ? monoNs : measure(processor, numChannels);
+
+        std::printf("%8d  %11.1f  %7.2f\n", numChannels, ns, ns / monoNs);
+    }
+
+    processor.releaseResources();
+
+    return 0;
+}
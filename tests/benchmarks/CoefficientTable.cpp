@@ -0,0 +1,155 @@
+/***************************************************************************//**
+ * @file CoefficientTable.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Per-sample coefficient lookup from a table, against designing.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "Benchmark.hpp"
+
+#include <vector>
+
+namespace
+{
+    using namespace StoneyDSP;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr std::size_t numSamples = 4096;
+
+    /** Returns the worst difference between two sets of coefficients. */
+    template <typename SampleType>
+    double getError(const Audio::BiquadsCoefficients<SampleType>& x, const Audio::BiquadsCoefficients<SampleType>& y) noexcept
+    {
+        return std::max({ std::abs(static_cast<double>(x.b0 - y.b0)), std::abs(static_cast<double>(x.b1 - y.b1)), std::abs(static_cast<double>(x.b2 - y.b2)),
+                          std::abs(static_cast<double>(x.a1 - y.a1)), std::abs(static_cast<double>(x.a2 - y.a2)) });
+    }
+
+    /**
+     * An LFO band's sweep, one new frequency per sample: +/- 2 octaves
+     * around 1kHz, as ```updateModulatedBands()``` would ask for it at a
+     * control block of one sample.
+     */
+    template <typename SampleType>
+    void run(const char* precision, Audio::BiquadsFilterType type, const char* typeName)
+    {
+        using coefficientsType = Audio::BiquadsCoefficients<SampleType>;
+
+        const auto resonance = static_cast<SampleType>(0.5);
+        const auto gain = static_cast<SampleType>(6.0);
+
+        std::vector<SampleType> frequencies(numSamples);
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+            frequencies[i] = static_cast<SampleType>(1000.0 * std::exp2(2.0 * std::sin(juce::MathConstants<double>::twoPi * static_cast<double>(i) / static_cast<double>(numSamples))));
+
+        std::vector<coefficientsType> exact(numSamples), coefficients(numSamples);
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+            exact[i] = Audio::Biquads<SampleType>::calculateCoefficients(type, frequencies[i], resonance, gain, sampleRate);
+
+        std::unique_ptr<Audio::BiquadsCoefficientTable<SampleType>> table;
+
+        const auto buildNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            table = std::make_unique<Audio::BiquadsCoefficientTable<SampleType>>(type, resonance, gain, sampleRate);
+        }, 4, 3);
+
+        juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32>(numSamples), 1 };
+        Audio::Biquads<SampleType> biquad;
+        biquad.prepare(spec);
+        biquad.setParameters(type, frequencies[0], resonance, gain);
+
+        const auto designNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            for (std::size_t i = 0; i < numSamples; ++i)
+                coefficients[i] = Audio::Biquads<SampleType>::calculateCoefficients(type, frequencies[i], resonance, gain, sampleRate);
+
+            Benchmarks::keep(coefficients.back());
+        }, 64) / static_cast<double>(numSamples);
+
+        const auto fastNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            for (std::size_t i = 0; i < numSamples; ++i)
+            {
+                biquad.setParametersFast(frequencies[i], resonance, gain);
+                coefficients[i] = biquad.getCoefficients();
+            }
+
+            Benchmarks::keep(coefficients.back());
+        }, 64) / static_cast<double>(numSamples);
+
+        double fastError = 0.0;
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+            fastError = std::max(fastError, getError(coefficients[i], exact[i]));
+
+        const auto linearNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            for (std::size_t i = 0; i < numSamples; ++i)
+                coefficients[i] = table->getLinear(frequencies[i]);
+
+            Benchmarks::keep(coefficients.back());
+        }, 64) / static_cast<double>(numSamples);
+
+        double linearError = 0.0;
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+            linearError = std::max(linearError, getError(coefficients[i], exact[i]));
+
+        const auto cubicNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            for (std::size_t i = 0; i < numSamples; ++i)
+                coefficients[i] = table->getCubic(frequencies[i]);
+
+            Benchmarks::keep(coefficients.back());
+        }, 64) / static_cast<double>(numSamples);
+
+        double cubicError = 0.0;
+
+        for (std::size_t i = 0; i < numSamples; ++i)
+            cubicError = std::max(cubicError, getError(coefficients[i], exact[i]));
+
+        const auto blockNs = Benchmarks::getNanosecondsPerCall([&]
+        {
+            table->getLinear(frequencies.data(), coefficients.data(), numSamples);
+            Benchmarks::keep(coefficients.back());
+        }, 64) / static_cast<double>(numSamples);
+
+        std::printf("%-6s  %-10s  %9.1f  %6.1f  %6.1f  %6.1f  %6.1f  %6.1f  %9.2e  %9.2e  %9.2e\n",
+                    precision, typeName, buildNs / 1000.0, designNs, fastNs, linearNs, cubicNs, blockNs, fastError, linearError, cubicError);
+    }
+}
+
+int main()
+{
+    std::printf("Coefficients per sample at %.0fHz, sweeping +/-2 octaves around 1kHz; times in ns per sample,\n", sampleRate);
+    std::printf("table build in us (%d points); errors are the worst coefficient difference from a full design.\n\n", Audio::BiquadsCoefficientTable<float>::defaultSize);
+    std::printf("%-6s  %-10s  %9s  %6s  %6s  %6s  %6s  %6s  %9s  %9s  %9s\n",
+                "", "type", "build", "design", "fast", "linear", "cubic", "block", "fast err", "lin err", "cubic err");
+
+    run<float> ("float",  Audio::BiquadsFilterType::peak,       "peak");
+    run<float> ("float",  Audio::BiquadsFilterType::lowPass2,   "lowPass2");
+    run<float> ("float",  Audio::BiquadsFilterType::highShelf2, "highShelf2");
+    run<double>("double", Audio::BiquadsFilterType::peak,       "peak");
+    run<double>("double", Audio::BiquadsFilterType::lowPass2,   "lowPass2");
+    run<double>("double", Audio::BiquadsFilterType::highShelf2, "highShelf2");
+
+    return 0;
+}
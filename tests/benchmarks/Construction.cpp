@@ -0,0 +1,191 @@
+/***************************************************************************//**
+ * @file Construction.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief What it costs to construct a processor, in time and in memory.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include "Benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+//==============================================================================
+// Every allocation in the program comes through here, and is counted, with
+// its size, while the thread that made it is counting; the background threads
+// that a processor starts are left alone. The size is kept just in front of
+// the block, so that what is freed again can be taken off.
+namespace
+{
+    thread_local bool isCountingAllocations = false;
+    thread_local long long numAllocations = 0;
+    thread_local long long numBytes = 0;
+
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        alignment = std::max(alignment, alignof(std::max_align_t));
+
+        const auto total = ((std::max(size, static_cast<std::size_t>(1)) + alignment + alignment - 1) / alignment) * alignment;
+
+#if JUCE_WINDOWS
+        auto* block = static_cast<char*>(_aligned_malloc(total, alignment));
+#else
+        auto* block = static_cast<char*>(std::aligned_alloc(alignment, total));
+#endif
+
+        if (block == nullptr)
+            throw std::bad_alloc();
+
+        auto* pointer = block + alignment;
+        reinterpret_cast<std::size_t*>(pointer)[-1] = size;
+        reinterpret_cast<std::size_t*>(pointer)[-2] = alignment;
+
+        if (isCountingAllocations)
+        {
+            ++numAllocations;
+            numBytes += static_cast<long long>(size);
+        }
+
+        return pointer;
+    }
+
+    void deallocate(void* pointer) noexcept
+    {
+        if (pointer == nullptr)
+            return;
+
+        const auto size      = static_cast<std::size_t*>(pointer)[-1];
+        const auto alignment = static_cast<std::size_t*>(pointer)[-2];
+
+        if (isCountingAllocations)
+            numBytes -= static_cast<long long>(size);
+
+#if JUCE_WINDOWS
+        _aligned_free(static_cast<char*>(pointer) - alignment);
+#else
+        std::free(static_cast<char*>(pointer) - alignment);
+#endif
+    }
+}
+
+void* operator new   (std::size_t size)                             { return allocate(size, 0); }
+void* operator new[] (std::size_t size)                             { return allocate(size, 0); }
+void* operator new   (std::size_t size, std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[] (std::size_t size, std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete   (void* pointer) noexcept                                      { deallocate(pointer); }
+void operator delete[] (void* pointer) noexcept                                      { deallocate(pointer); }
+void operator delete   (void* pointer, std::size_t) noexcept                         { deallocate(pointer); }
+void operator delete[] (void* pointer, std::size_t) noexcept                         { deallocate(pointer); }
+void operator delete   (void* pointer, std::align_val_t) noexcept                    { deallocate(pointer); }
+void operator delete[] (void* pointer, std::align_val_t) noexcept                    { deallocate(pointer); }
+void operator delete   (void* pointer, std::size_t, std::align_val_t) noexcept       { deallocate(pointer); }
+void operator delete[] (void* pointer, std::size_t, std::align_val_t) noexcept       { deallocate(pointer); }
+
+namespace
+{
+    using namespace StoneyDSP;
+
+    constexpr int numRuns = 7;
+
+    struct Cost
+    {
+        double ns = 0.0;
+        double bytes = 0.0;
+        double allocations = 0.0;
+    };
+
+    /**
+     * Constructs ```numObjects``` objects with ```create```, ```numRuns```
+     * times over, and returns the time of the fastest run and the heap still
+     * held once they are all built, per object.
+     */
+    template <typename ObjectType, typename Create>
+    Cost measure(int numObjects, Create&& create)
+    {
+        std::vector<std::unique_ptr<ObjectType>> objects;
+        objects.reserve(static_cast<std::size_t>(numObjects));
+
+        Cost cost;
+        cost.ns = std::numeric_limits<double>::max();
+
+        for (int run = 0; run < numRuns; ++run)
+        {
+            numAllocations = 0;
+            numBytes = 0;
+            isCountingAllocations = true;
+
+            const auto start = std::chrono::steady_clock::now();
+
+            for (int i = 0; i < numObjects; ++i)
+                objects.push_back(create());
+
+            const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+            isCountingAllocations = false;
+
+            cost.ns = std::min(cost.ns, elapsed.count() / static_cast<double>(numObjects));
+            cost.bytes = static_cast<double>(numBytes) / static_cast<double>(numObjects);
+            cost.allocations = static_cast<double>(numAllocations) / static_cast<double>(numObjects);
+
+            objects.clear();
+        }
+
+        return cost;
+    }
+
+    void print(const char* name, int numObjects, std::size_t size, const Cost& cost)
+    {
+        std::printf("%-10s  %5d  %8.1f  %8.1f  %8.1f  %6.1f\n",
+                    name, numObjects, static_cast<double>(size) / 1024.0, cost.bytes / 1024.0, cost.ns / 1000.0, cost.allocations);
+    }
+}
+
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    std::printf("N instances built one after another; sizeof in KB, heap held once built (the instance included)\n");
+    std::printf("in KB, and construction time in us, each. A processor builds only the wrapper for its current\n");
+    std::printf("precision, float unless the host asks for double; building both would add the other line.\n\n");
+    std::printf("%-10s  %5s  %8s  %8s  %8s  %6s\n", "", "N", "size", "heap", "time", "allocs");
+
+    for (const auto numObjects : { 1, 8, 64 })
+        print("processor", numObjects, sizeof(Biquads::AudioPluginAudioProcessor),
+              measure<Biquads::AudioPluginAudioProcessor>(numObjects, [] { return std::make_unique<Biquads::AudioPluginAudioProcessor>(); }));
+
+    Biquads::AudioPluginAudioProcessor processor;
+    auto& apvts = processor.getApvts();
+    juce::dsp::ProcessSpec spec { 48000.0, 512, 2 };
+
+    for (const auto numObjects : { 1, 8, 64 })
+        print("float", numObjects, sizeof(Biquads::AudioPluginAudioProcessorWrapper<float>),
+              measure<Biquads::AudioPluginAudioProcessorWrapper<float>>(numObjects, [&] { return std::make_unique<Biquads::AudioPluginAudioProcessorWrapper<float>>(processor, apvts, spec); }));
+
+    for (const auto numObjects : { 1, 8, 64 })
+        print("double", numObjects, sizeof(Biquads::AudioPluginAudioProcessorWrapper<double>),
+              measure<Biquads::AudioPluginAudioProcessorWrapper<double>>(numObjects, [&] { return std::make_unique<Biquads::AudioPluginAudioProcessorWrapper<double>>(processor, apvts, spec); }));
+
+    return 0;
+}
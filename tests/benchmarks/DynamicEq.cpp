@@ -0,0 +1,113 @@
+/***************************************************************************//**
+ * @file DynamicEq.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The cost of dynamic bands, against the same bands held static.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include "Benchmark.hpp"
+
+#include <vector>
+
+namespace
+{
+    using namespace StoneyDSP;
+    using Parameters = Biquads::AudioPluginAudioProcessorParameters;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+
+    /**
+     * Switches every band on, as peaks spread from 100Hz to 10kHz, and makes
+     * the first ```numDynamicBands``` of them dynamic. The threshold is
+     * under the whole test signal, so the dynamic bands never rest.
+     */
+    void setBands(juce::AudioProcessorValueTreeState& apvts, std::size_t numDynamicBands)
+    {
+        for (std::size_t band = 0; band < Parameters::numBands; ++band)
+        {
+            const auto position = Parameters::numBands > 1 ? static_cast<float>(band) / static_cast<float>(Parameters::numBands - 1) : 0.0f;
+
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "bypass"),    0.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "frequency"), 100.0f * std::pow(100.0f, position));
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "resonance"), 0.5f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "gain"),      6.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "type"),      12.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "dynamic"),   band < numDynamicBands ? 1.0f : 0.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "threshold"), -60.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "ratio"),     4.0f);
+        }
+    }
+
+    double measure(Biquads::AudioPluginAudioProcessor& processor, std::size_t numDynamicBands, bool isUsingSidechain)
+    {
+        auto layout = processor.getBusesLayout();
+        layout.inputBuses.getReference(1) = isUsingSidechain ? juce::AudioChannelSet::stereo() : juce::AudioChannelSet::disabled();
+
+        const auto isLayoutSet = processor.setBusesLayout(layout);
+        jassert(isLayoutSet);
+        juce::ignoreUnused(isLayoutSet);
+
+        setBands(processor.getApvts(), numDynamicBands);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        return Benchmarks::getNanosecondsPerSample<float>(processor, blockSize);
+    }
+}
+
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    Biquads::AudioPluginAudioProcessor processor;
+
+    std::printf("%d peak bands, stereo at %.0fHz in blocks of %d, dynamic bands updated every %d samples;\n",
+                static_cast<int>(Parameters::numBands), sampleRate, blockSize, STONEYDSP_BIQUADS_CONTROL_BLOCK_SIZE);
+    std::printf("ns per sample frame, detecting from the input or from a stereo sidechain.\n\n");
+    std::printf("%7s  %8s  %7s  %9s  %7s\n", "dynamic", "input", "/static", "sidechain", "/static");
+
+    // None, then powers of two, then every band.
+    std::vector<std::size_t> numsDynamicBands { 0 };
+
+    for (std::size_t numDynamicBands = 1; numDynamicBands < Parameters::numBands; numDynamicBands *= 2)
+        numsDynamicBands.push_back(numDynamicBands);
+
+    numsDynamicBands.push_back(Parameters::numBands);
+
+    // Once to wake the CPU up.
+    measure(processor, 0, false);
+
+    const auto staticNs = measure(processor, 0, false);
+    const auto staticSidechainNs = measure(processor, 0, true);
+
+    for (const auto numDynamicBands : numsDynamicBands)
+    {
+        const auto inputNs = measure(processor, numDynamicBands, false);
+        const auto sidechainNs = measure(processor, numDynamicBands, true);
+
+        std::printf("%7d  %8.1f  %7.2f  %9.1f  %7.2f\n", static_cast<int>(numDynamicBands), inputNs, inputNs / staticNs, sidechainNs, sidechainNs / staticSidechainNs);
+    }
+
+    processor.releaseResources();
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/***************************************************************************//**
+ * @file Lfo.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The worst-case cost of the band LFOs.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include "Benchmark.hpp"
+
+namespace
+{
+    using namespace StoneyDSP;
+    using Parameters = Biquads::AudioPluginAudioProcessorParameters;
+
+    constexpr double sampleRate = 48000.0;
+
+    /**
+     * Switches every band on, as peaks spread from 100Hz to 10kHz, each swept
+     * by its LFO over +/- ```lfoDepth``` octaves and, if ```isDynamic```,
+     * following the level of the input too.
+     */
+    void setBands(juce::AudioProcessorValueTreeState& apvts, float lfoDepth, bool isDynamic)
+    {
+        for (std::size_t band = 0; band < Parameters::numBands; ++band)
+        {
+            const auto position = Parameters::numBands > 1 ? static_cast<float>(band) / static_cast<float>(Parameters::numBands - 1) : 0.0f;
+
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "bypass"),    0.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "frequency"), 100.0f * std::pow(100.0f, position));
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "resonance"), 0.5f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "gain"),      6.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "type"),      12.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "lfoDepth"),  lfoDepth);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "lfoRate"),   5.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "dynamic"),   isDynamic ? 1.0f : 0.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "threshold"), -60.0f);
+        }
+    }
+
+    double measure(Biquads::AudioPluginAudioProcessor& processor, int blockSize, float lfoDepth, bool isDynamic)
+    {
+        setBands(processor.getApvts(), lfoDepth, isDynamic);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        return Benchmarks::getNanosecondsPerSample<float>(processor, blockSize);
+    }
+}
+
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    Biquads::AudioPluginAudioProcessor processor;
+
+    constexpr auto controlBlockSize = STONEYDSP_BIQUADS_CONTROL_BLOCK_SIZE;
+    constexpr auto numBands = static_cast<double>(Parameters::numBands);
+
+    std::printf("%d peak bands, stereo at %.0fHz, modulated bands updated every %d samples%s;\n",
+                static_cast<int>(Parameters::numBands), sampleRate, controlBlockSize,
+                STONEYDSP_BIQUADS_USING_COEFFICIENT_TABLE ? " from coefficient tables" : "");
+    std::printf("ns per sample frame, and the cost of one band update worked out from the LFO column.\n\n");
+    std::printf("%5s  %7s  %7s  %11s  %11s\n", "block", "static", "LFO", "LFO+dynamic", "per update");
+
+    // Once to wake the CPU up.
+    measure(processor, 512, 0.0f, false);
+
+    for (const auto blockSize : { 32, 128, 512 })
+    {
+        const auto staticNs  = measure(processor, blockSize, 0.0f, false);
+        const auto lfoNs     = measure(processor, blockSize, 2.0f, false);
+        const auto dynamicNs = measure(processor, blockSize, 2.0f, true);
+
+        std::printf("%5d  %7.1f  %7.1f  %11.1f  %11.1f\n", blockSize, staticNs, lfoNs, dynamicNs, (lfoNs - staticNs) * controlBlockSize / numBands);
+    }
+
+    processor.releaseResources();
+
+    return 0;
+}
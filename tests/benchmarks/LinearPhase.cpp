@@ -0,0 +1,135 @@
+/***************************************************************************//**
+ * @file LinearPhase.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The cost of the linear-phase convolution against kernel length, head size and block size.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "Benchmark.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace StoneyDSP;
+
+    constexpr int numSamples = 1 << 15;
+    constexpr int numChannels = 2;
+
+    constexpr int headSizes[]  = { 0, 64, 128, 256, 512, 1024, 2048, 4096 };
+    constexpr int blockSizes[] = { 32, 64, 128, 256, 512, 1024 };
+
+    /** Four peaks, spread from 100Hz to 10kHz. */
+    std::vector<Audio::BiquadsCoefficients<float>> getSections(double sampleRate)
+    {
+        std::vector<Audio::BiquadsCoefficients<float>> sections;
+
+        for (const auto frequency : { 100.0f, 464.0f, 2154.0f, 10000.0f })
+            sections.push_back(Audio::Biquads<float>::calculateCoefficients(Audio::BiquadsFilterType::peak, frequency, 0.5f, 6.0f, sampleRate));
+
+        return sections;
+    }
+
+    /** Returns ns per sample frame of stereo convolution, in blocks of ```blockSize``` samples. */
+    double measure(double sampleRate, int headSize, int blockSize)
+    {
+        const auto sections = getSections(sampleRate);
+
+        Audio::BiquadsLinearPhase<float> linearPhase(headSize);
+        linearPhase.setSections(sections.data(), sections.size());
+        linearPhase.prepare({ sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels) });
+
+        const auto numBlocks = numSamples / blockSize;
+
+        juce::AudioBuffer<float> source(numChannels, numBlocks * blockSize);
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            Benchmarks::fillWithTestSignal(source.getWritePointer(channel), static_cast<std::size_t>(source.getNumSamples()), static_cast<std::size_t>(channel) * 101);
+
+        const auto processAll = [&]
+        {
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                for (int channel = 0; channel < numChannels; ++channel)
+                    buffer.copyFrom(channel, 0, source, channel, block * blockSize, blockSize);
+
+                juce::dsp::AudioBlock<float> audioBlock(buffer);
+                linearPhase.process(juce::dsp::ProcessContextReplacing<float>(audioBlock));
+            }
+
+            Benchmarks::keep(*buffer.getReadPointer(0));
+        };
+
+        // The kernel is loaded by the convolution's own thread and crossfaded
+        // in; give it time to arrive and settle before timing anything.
+        for (int i = 0; i < 20; ++i)
+        {
+            processAll();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        return Benchmarks::getNanosecondsPerCall(processAll, 1) / static_cast<double>(numBlocks * blockSize);
+    }
+}
+
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    std::printf("Linear phase, stereo; ns per sample frame by head size (rows; 0 is uniform) and block size (columns).\n");
+    std::printf("The cheapest head size for each block size is marked with a *.\n");
+
+    for (const auto sampleRate : { 48000.0, 96000.0, 192000.0 })
+    {
+        std::printf("\n%.0fHz, kernel of %d samples\n%5s", sampleRate, 1 << Audio::BiquadsLinearPhase<float>::getOrderForSampleRate(sampleRate), "head");
+
+        for (const auto blockSize : blockSizes)
+            std::printf("  %7d ", blockSize);
+
+        std::printf("\n");
+
+        double results[std::size(headSizes)][std::size(blockSizes)];
+
+        for (std::size_t h = 0; h < std::size(headSizes); ++h)
+            for (std::size_t b = 0; b < std::size(blockSizes); ++b)
+                results[h][b] = measure(sampleRate, headSizes[h], blockSizes[b]);
+
+        for (std::size_t h = 0; h < std::size(headSizes); ++h)
+        {
+            std::printf("%5d", headSizes[h]);
+
+            for (std::size_t b = 0; b < std::size(blockSizes); ++b)
+            {
+                auto isBest = true;
+
+                for (std::size_t other = 0; other < std::size(headSizes); ++other)
+                    isBest = isBest && results[other][b] >= results[h][b];
+
+                std::printf("  %7.1f%c", results[h][b], isBest ? '*' : ' ');
+            }
+
+            std::printf("\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+/***************************************************************************//**
+ * @file Matched.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The Matched design against the bilinear one, plain and oversampled: error against the analog filter, and cost.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "Benchmark.hpp"
+
+#include <complex>
+#include <vector>
+
+namespace
+{
+    using namespace StoneyDSP;
+    using filterType = Audio::BiquadsFilterType;
+    using designMethodType = Audio::BiquadsDesignMethod;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr double resonance = 0.3;
+    constexpr std::size_t numSamples = 4096;
+
+    /** Below this, the analog response is too far down for its error to matter. */
+    constexpr double floorDecibels = -30.0;
+
+    /**
+     * The analog prototype of a type, in dB, at ```x``` times its centre
+     * frequency: s = jx and 1 / Q = 2 zeta, with the shelves and the peak
+     * using 'a' where the RBJ cookbook uses A, as the designs do.
+     */
+    double getAnalogDecibels(filterType type, double x, double gain)
+    {
+        const std::complex<double> s(0.0, x);
+        const auto zeta = 1.0 - resonance;
+        const auto a = juce::Decibels::decibelsToGain(gain);
+        const auto sqrtA = std::sqrt(a);
+        const auto resonant = (s * s) + (2.0 * zeta * s) + 1.0;
+
+        std::complex<double> response(1.0);
+
+        switch (type)
+        {
+        case filterType::lowPass2:   response = 1.0 / resonant; break;
+        case filterType::highPass2:  response = (s * s) / resonant; break;
+        case filterType::bandPass:   response = s / resonant; break;
+        case filterType::peak:       response = ((s * s) + (2.0 * zeta * a * s) + 1.0) / ((s * s) + (2.0 * zeta * s / a) + 1.0); break;
+        case filterType::lowShelf2:  response = a * ((s * s) + (2.0 * zeta * sqrtA * s) + a) / ((a * s * s) + (2.0 * zeta * sqrtA * s) + 1.0); break;
+        case filterType::highShelf2: response = a * ((a * s * s) + (2.0 * zeta * sqrtA * s) + 1.0) / ((s * s) + (2.0 * zeta * sqrtA * s) + a); break;
+        case filterType::notch:      response = ((s * s) + 1.0) / resonant; break;
+        default: break;
+        }
+
+        return juce::Decibels::gainToDecibels(std::abs(response), -300.0);
+    }
+
+    /** The response of a set of coefficients, in dB, at ```omega``` radians per sample. */
+    double getDigitalDecibels(const Audio::BiquadsCoefficients<double>& c, double omega)
+    {
+        const auto z = std::polar(1.0, -omega);
+        const auto response = (c.b0 + (c.b1 * z) + (c.b2 * z * z)) / (1.0 - (c.a1 * z) - (c.a2 * z * z));
+
+        return juce::Decibels::gainToDecibels(std::abs(response), -300.0);
+    }
+
+    /**
+     * Returns the worst error, in dB, against the analog filter from 20Hz to
+     * 20kHz, of a band designed at ```factor``` times the sample rate. The
+     * resampling is taken to be ideal, so only the design is measured.
+     */
+    double getError(filterType type, double frequency, double gain, int factor, designMethodType method)
+    {
+        const auto rate = sampleRate * static_cast<double>(factor);
+        const auto coefficients = Audio::Biquads<double>::calculateCoefficients(type, frequency, resonance, gain, rate, method);
+
+        double worstError = 0.0;
+
+        // 1/24 of an octave apart.
+        for (int i = 0; i <= 240; ++i)
+        {
+            const auto hz = 20.0 * std::pow(1000.0, static_cast<double>(i) / 240.0);
+            const auto analog = getAnalogDecibels(type, hz / frequency, gain);
+
+            if (analog < floorDecibels)
+                continue;
+
+            const auto digital = getDigitalDecibels(coefficients, juce::MathConstants<double>::twoPi * hz / rate);
+            worstError = std::max(worstError, std::abs(digital - analog));
+        }
+
+        return worstError;
+    }
+
+    /**
+     * Returns the cost of a mono band per sample at the base rate, in ns:
+     * ```factor``` samples through the filter for each one, before the
+     * resampling filters (which the Oversampling setting shares between
+     * every band of its group) are counted.
+     */
+    double getNanosecondsPerSample(filterType type, double frequency, double gain, int factor, designMethodType method)
+    {
+        const auto length = numSamples * static_cast<std::size_t>(factor);
+
+        juce::dsp::ProcessSpec spec { sampleRate * static_cast<double>(factor), static_cast<juce::uint32>(length), 1 };
+        Audio::Biquads<float> biquad;
+        biquad.prepare(spec);
+        biquad.setDesignMethod(method);
+        biquad.setParameters(type, static_cast<float>(frequency), static_cast<float>(resonance), static_cast<float>(gain));
+
+        std::vector<float> samples(length);
+        Benchmarks::fillWithTestSignal(samples.data(), length);
+
+        float* channels[] = { samples.data() };
+        juce::dsp::AudioBlock<float> block(channels, 1, length);
+
+        const auto ns = Benchmarks::getNanosecondsPerCall([&]
+        {
+            biquad.process(juce::dsp::ProcessContextReplacing<float>(block));
+            Benchmarks::keep(samples.back());
+        }, 64);
+
+        return ns / static_cast<double>(numSamples);
+    }
+
+    void run(filterType type, const char* typeName, double frequency, double gain)
+    {
+        struct Design
+        {
+            int factor;
+            designMethodType method;
+        };
+
+        constexpr Design designs[] = {
+            { 1, designMethodType::bilinear },
+            { 2, designMethodType::bilinear },
+            { 4, designMethodType::bilinear },
+            { 1, designMethodType::matched }
+        };
+
+        std::printf("%-4s  %5.0fHz  %+5.0fdB", typeName, frequency, gain * 2.0);
+
+        for (const auto& design : designs)
+            std::printf("  %8.1fdB", getError(type, frequency, gain, design.factor, design.method));
+
+        for (const auto& design : designs)
+            std::printf("  %6.2f", getNanosecondsPerSample(type, frequency, gain, design.factor, design.method));
+
+        std::printf("\n");
+    }
+}
+
+int main()
+{
+    std::printf("Worst error against the analog filter from 20Hz to 20kHz (where it is above %.0fdB), at %.0fHz and\n", floorDecibels, sampleRate);
+    std::printf("Resonance %.1f, designed at 1x, 2x and 4x the rate (ideal resampling) and Matched; then ns per sample,\n", resonance);
+    std::printf("mono, for the filter alone.\n\n");
+    std::printf("%-4s  %7s  %7s  %10s  %10s  %10s  %10s  %6s  %6s  %6s  %6s\n",
+                "type", "freq", "gain", "bilinear", "2x", "4x", "matched", "ns", "2x", "4x", "matched");
+
+    // The Gain parameter is half the peak's (and the shelves') gain in dB.
+    run(filterType::lowPass2,   "LP2",  5000.0,  0.0);
+    run(filterType::lowPass2,   "LP2", 16000.0,  0.0);
+    run(filterType::highPass2,  "HP2", 16000.0,  0.0);
+    run(filterType::bandPass,   "BP2",  5000.0,  0.0);
+    run(filterType::peak,       "PK2", 16000.0,  6.0);
+    run(filterType::lowShelf2,  "LS2", 16000.0, -6.0);
+    run(filterType::highShelf2, "HS2", 16000.0,  6.0);
+    run(filterType::notch,      "NX2", 16000.0,  0.0);
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/***************************************************************************//**
+ * @file Reblock.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The cost per sample against the host block size, with and without re-blocking.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "Benchmark.hpp"
+
+#include <vector>
+
+namespace
+{
+    using namespace StoneyDSP;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int numChannels = 2;
+    constexpr int numSamples = 1 << 18;
+    constexpr std::size_t reblockSize = 64;
+
+    /**
+     * Four peaks and a dry/wet mix, with the same kind of fixed work per
+     * block as the wrapper: a mix push and one process context per band.
+     */
+    struct Chain
+    {
+        Chain(int maximumBlockSize, std::size_t blockSize, bool isFixedLatency)
+        {
+            juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32>(maximumBlockSize), static_cast<juce::uint32>(numChannels) };
+
+            auto arenaSize = mixer.getArenaSize(spec) + Audio::Reblocker<float>::getArenaSize(numChannels, blockSize, isFixedLatency);
+
+            for (auto& biquad : biquads)
+                arenaSize += biquad.getArenaSize(spec);
+
+            arena.prepare(arenaSize);
+
+            for (std::size_t band = 0; band < biquads.size(); ++band)
+            {
+                biquads[band].prepare(spec, arena);
+                biquads[band].setParameters(Audio::BiquadsFilterType::peak, 200.0f * static_cast<float>(band + 1), 0.7f, 3.0f);
+                biquads[band].reset(0.0f);
+            }
+
+            mixer.prepare(spec, arena);
+            mixer.setWetMixProportion(0.5f);
+            mixer.reset();
+
+            reblocker.prepare(numChannels, blockSize, isFixedLatency, arena);
+        }
+
+        void process(juce::AudioBuffer<float>& buffer)
+        {
+            reblocker.process(buffer, [this](juce::AudioBuffer<float>& block)
+            {
+                juce::dsp::AudioBlock<float> audioBlock(block);
+                mixer.pushDrySamples(audioBlock);
+
+                juce::dsp::ProcessContextReplacing<float> context(audioBlock);
+
+                for (auto& biquad : biquads)
+                    biquad.process(context);
+
+                mixer.mixWetSamples(audioBlock);
+            });
+        }
+
+        Core::Arena arena;
+        std::array<Audio::Biquads<float>, 4> biquads;
+        Audio::DryWetMixer<float> mixer;
+        Audio::Reblocker<float> reblocker;
+    };
+
+    /** Returns ns per sample frame, in host blocks of ```hostBlockSize``` samples. */
+    double measure(int hostBlockSize, std::size_t blockSize, bool isFixedLatency)
+    {
+        const auto numBlocks = numSamples / hostBlockSize;
+
+        Chain chain(blockSize == 0 ? hostBlockSize : static_cast<int>(std::max(blockSize, static_cast<std::size_t>(hostBlockSize))), blockSize, isFixedLatency);
+
+        juce::AudioBuffer<float> source(numChannels, numBlocks * hostBlockSize);
+        juce::AudioBuffer<float> buffer(numChannels, numBlocks * hostBlockSize);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            Benchmarks::fillWithTestSignal(source.getWritePointer(channel), static_cast<std::size_t>(source.getNumSamples()), static_cast<std::size_t>(channel) * 101);
+
+        const auto processAll = [&]
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                buffer.copyFrom(channel, 0, source, channel, 0, source.getNumSamples());
+
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                juce::AudioBuffer<float> hostBlock(buffer.getArrayOfWritePointers(), numChannels, block * hostBlockSize, hostBlockSize);
+                chain.process(hostBlock);
+            }
+
+            Benchmarks::keep(*buffer.getReadPointer(0));
+        };
+
+        processAll();
+
+        return Benchmarks::getNanosecondsPerCall(processAll, 1) / static_cast<double>(numBlocks * hostBlockSize);
+    }
+}
+
+int main()
+{
+    std::printf("4 peaks and a mix, stereo at %.0fHz; ns per sample frame by host block size,\n", sampleRate);
+    std::printf("as the host sends it, split into blocks of %d, and through a FIFO of %d.\n\n", static_cast<int>(reblockSize), static_cast<int>(reblockSize));
+    std::printf("%5s  %7s  %7s  %7s\n", "host", "direct", "split", "FIFO");
+
+    for (const auto hostBlockSize : { 1, 7, 32, 64, 441, 512, 1023 })
+    {
+        std::printf("%5d  %7.2f  %7.2f  %7.2f\n", hostBlockSize,
+                    measure(hostBlockSize, 0, false),
+                    measure(hostBlockSize, reblockSize, false),
+                    measure(hostBlockSize, reblockSize, true));
+    }
+
+    return 0;
+}
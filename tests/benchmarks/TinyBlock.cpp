@@ -0,0 +1,146 @@
+/***************************************************************************//**
+ * @file TinyBlock.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief The cost of small host blocks, on either side of the tiny-block limit.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include "Benchmark.hpp"
+
+namespace
+{
+    using namespace StoneyDSP;
+    using Parameters = Biquads::AudioPluginAudioProcessorParameters;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int maximumBlockSize = 512;
+    constexpr int maxTinyBlockSize = 32; // as in the wrapper
+    constexpr int numSamples = 1 << 16;
+
+    /**
+     * Switches the first ```numActiveBands``` bands on, as peaks spread from
+     * 100Hz to 10kHz, at a Mix of 50%, and the rest off.
+     */
+    void setBands(juce::AudioProcessorValueTreeState& apvts, std::size_t numActiveBands)
+    {
+        for (std::size_t band = 0; band < Parameters::numBands; ++band)
+        {
+            const auto position = Parameters::numBands > 1 ? static_cast<float>(band) / static_cast<float>(Parameters::numBands - 1) : 0.0f;
+
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "bypass"),    band < numActiveBands ? 0.0f : 1.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "frequency"), 100.0f * std::pow(100.0f, position));
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "resonance"), 0.5f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "gain"),      6.0f);
+            Benchmarks::setParameter(apvts, Parameters::getBandParameterID(band, "type"),      12.0f);
+        }
+
+        Benchmarks::setParameter(apvts, "Master_mixID", 50.0f);
+    }
+
+    /**
+     * Returns ns per sample frame in blocks of ```blockSize``` samples, and
+     * whether they took the fast path. With ```isAutomating```, the Attack
+     * is moved before every block, as a host playing back automation would;
+     * it changes nothing without dynamic bands, but every block then takes
+     * the full path, as it would with any other change.
+     */
+    double measure(Biquads::AudioPluginAudioProcessor& processor, std::size_t numActiveBands, int blockSize, bool isAutomating, bool& tookTinyBlockPath)
+    {
+        auto& apvts = processor.getApvts();
+        auto* attack = apvts.getParameter("Master_attackID");
+        jassert(attack != nullptr);
+
+        setBands(apvts, numActiveBands);
+        processor.prepareToPlay(sampleRate, maximumBlockSize);
+
+        const auto numChannels = std::max(processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+        const auto numBlocks = std::max(1, numSamples / blockSize);
+
+        juce::AudioBuffer<float> source(numChannels, numBlocks * blockSize);
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+        juce::MidiBuffer midiMessages;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            Benchmarks::fillWithTestSignal(source.getWritePointer(channel), static_cast<std::size_t>(source.getNumSamples()), static_cast<std::size_t>(channel) * 101);
+
+        const auto processAll = [&]
+        {
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                if (isAutomating)
+                    attack->setValueNotifyingHost((block & 1) == 0 ? 0.25f : 0.5f);
+
+                for (int channel = 0; channel < numChannels; ++channel)
+                    buffer.copyFrom(channel, 0, source, channel, block * blockSize, blockSize);
+
+                processor.processBlock(buffer, midiMessages);
+            }
+
+            Benchmarks::keep(*buffer.getReadPointer(0));
+        };
+
+        // Once to settle the smoothing, the ramps and the first snapshot.
+        processAll();
+
+        const auto ns = Benchmarks::getNanosecondsPerCall(processAll, 1) / static_cast<double>(numBlocks * blockSize);
+        tookTinyBlockPath = blockSize <= maxTinyBlockSize && processor.isUsingTinyBlockPath();
+
+        return ns;
+    }
+}
+
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    Biquads::AudioPluginAudioProcessor processor;
+
+    std::printf("Peak bands and a 50%% Mix, stereo at %.0fHz; ns per sample frame by host block size,\n", sampleRate);
+    std::printf("with nothing changing (* where the fast path was taken), and with the Attack automated every block.\n\n");
+    std::printf("%5s  %8s  %9s  %8s  %9s\n", "block", "1 band", "automated", (juce::String(static_cast<int>(Parameters::numBands)) + " bands").toRawUTF8(), "automated");
+
+    const std::size_t numsActiveBands[] = { 1, Parameters::numBands };
+    bool tookTinyBlockPath = false;
+
+    // Once to wake the CPU up.
+    measure(processor, 1, maximumBlockSize, false, tookTinyBlockPath);
+
+    for (const auto blockSize : { 1, 2, 4, 8, 16, 24, maxTinyBlockSize, maxTinyBlockSize + 1, 64, 128, 512 })
+    {
+        std::printf("%5d", blockSize);
+
+        for (const auto numActiveBands : numsActiveBands)
+        {
+            const auto staticNs = measure(processor, numActiveBands, blockSize, false, tookTinyBlockPath);
+            const auto staticMark = tookTinyBlockPath ? '*' : ' ';
+            const auto automatedNs = measure(processor, numActiveBands, blockSize, true, tookTinyBlockPath);
+
+            std::printf("  %7.2f%c  %9.2f", staticNs, staticMark, automatedNs);
+        }
+
+        std::printf("\n");
+    }
+
+    processor.releaseResources();
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/***************************************************************************//**
+ * @file AllocationTests.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Checks that the audio thread never goes to the heap.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include <cstdlib>
+#include <new>
+
+//==============================================================================
+// Every allocation in the program comes through here, and is counted while the
+// thread that made it is counting; the message thread and the background
+// threads (kernel design, the design service) are left alone.
+namespace
+{
+    thread_local bool isCountingAllocations = false;
+    thread_local int numAllocations = 0;
+
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        if (isCountingAllocations)
+            ++numAllocations;
+
+        alignment = std::max(alignment, alignof(std::max_align_t));
+        size = ((std::max(size, static_cast<std::size_t>(1)) + alignment - 1) / alignment) * alignment;
+
+#if JUCE_WINDOWS
+        auto* pointer = _aligned_malloc(size, alignment);
+#else
+        auto* pointer = std::aligned_alloc(alignment, size);
+#endif
+
+        if (pointer == nullptr)
+            throw std::bad_alloc();
+
+        return pointer;
+    }
+
+    void deallocate(void* pointer) noexcept
+    {
+#if JUCE_WINDOWS
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+}
+
+void* operator new   (std::size_t size)                             { return allocate(size, 0); }
+void* operator new[] (std::size_t size)                             { return allocate(size, 0); }
+void* operator new   (std::size_t size, std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[] (std::size_t size, std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete   (void* pointer) noexcept                                      { deallocate(pointer); }
+void operator delete[] (void* pointer) noexcept                                      { deallocate(pointer); }
+void operator delete   (void* pointer, std::size_t) noexcept                         { deallocate(pointer); }
+void operator delete[] (void* pointer, std::size_t) noexcept                         { deallocate(pointer); }
+void operator delete   (void* pointer, std::align_val_t) noexcept                    { deallocate(pointer); }
+void operator delete[] (void* pointer, std::align_val_t) noexcept                    { deallocate(pointer); }
+void operator delete   (void* pointer, std::size_t, std::align_val_t) noexcept       { deallocate(pointer); }
+void operator delete[] (void* pointer, std::size_t, std::align_val_t) noexcept       { deallocate(pointer); }
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Biquads {
+/** @addtogroup Biquads @{ */
+
+//==============================================================================
+class AllocationTests : public juce::UnitTest
+{
+public:
+    AllocationTests() : juce::UnitTest("Allocation", "StoneyDSP") {}
+
+    void runTest() override
+    {
+        constexpr double sampleRate = 48000.0;
+        constexpr int maximumBlockSize = 512;
+
+        AudioPluginAudioProcessor processor;
+        processor.prepareToPlay(sampleRate, maximumBlockSize);
+
+        const auto numChannels = std::max(processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+        juce::AudioBuffer<float> buffer(numChannels, maximumBlockSize);
+        juce::MidiBuffer midiMessages;
+        auto random = getRandom();
+
+        beginTest("Processing does not allocate");
+        {
+            int count = 0;
+
+            for (int i = 0; i < 64; ++i)
+                count += processAndCount(processor, buffer, maximumBlockSize, midiMessages, random);
+
+            expectEquals(count, 0);
+        }
+
+        // Every parameter, the oversampling, the slope, the phase and the
+        // stereo mode included, at random, over block sizes that take both
+        // the tiny-block and the full path; the new snapshot is applied on
+        // the audio thread at the start of the next block.
+        beginTest("Parameter changes do not allocate on the audio thread");
+        {
+            auto& parameters = static_cast<juce::AudioProcessor&>(processor).getParameters();
+
+            for (int i = 0; i < 512; ++i)
+            {
+                juce::String changed;
+
+                for (int j = random.nextInt({ 1, 4 }); --j >= 0;)
+                {
+                    auto* parameter = parameters[random.nextInt(parameters.size())];
+                    parameter->setValueNotifyingHost(random.nextFloat());
+                    changed << parameter->getName(64) << " ";
+                }
+
+                for (int j = 0; j < 4; ++j)
+                {
+                    const auto numSamples = random.nextBool() ? random.nextInt({ 1, 33 }) : random.nextInt({ 1, maximumBlockSize + 1 });
+                    expectEquals(processAndCount(processor, buffer, numSamples, midiMessages, random), 0, "after changing " + changed);
+                }
+            }
+        }
+
+        processor.releaseResources();
+
+        // Offline at the best quality, every band is designed on the audio
+        // thread, and a 7.1.4 bus is shared out across the offline pool in
+        // groups of channels; the switch itself is made in prepareToPlay().
+        beginTest("An offline render at the best quality does not allocate on the audio thread");
+        {
+            AudioPluginAudioProcessor offlineProcessor;
+
+            auto layout = offlineProcessor.getBusesLayout();
+            layout.inputBuses.getReference(0) = juce::AudioChannelSet::create7point1point4();
+            layout.outputBuses.getReference(0) = juce::AudioChannelSet::create7point1point4();
+
+            const auto isLayoutSet = offlineProcessor.setBusesLayout(layout);
+            expect(isLayoutSet);
+
+            auto* offline = offlineProcessor.getApvts().getParameter("Master_offlineID");
+            offline->setValueNotifyingHost(offline->convertTo0to1(1.0f));
+
+            // One band at the base rate, which the pool runs, and the others
+            // oversampled to 16x.
+            auto* bandOs = offlineProcessor.getApvts().getParameter(AudioPluginAudioProcessorParameters::getBandParameterID(0, "os"));
+            bandOs->setValueNotifyingHost(bandOs->convertTo0to1(0.0f));
+
+            for (std::size_t band = 1; band < AudioPluginAudioProcessorParameters::numBands; ++band)
+            {
+                auto* bypass = offlineProcessor.getApvts().getParameter(AudioPluginAudioProcessorParameters::getBandParameterID(band, "bypass"));
+                bypass->setValueNotifyingHost(0.0f);
+            }
+
+            offlineProcessor.setNonRealtime(true);
+            offlineProcessor.prepareToPlay(sampleRate, maximumBlockSize);
+            expect(offlineProcessor.isUsingMixedPrecision());
+
+            const auto numOfflineChannels = std::max(offlineProcessor.getTotalNumInputChannels(), offlineProcessor.getTotalNumOutputChannels());
+            juce::AudioBuffer<float> offlineBuffer(numOfflineChannels, maximumBlockSize);
+            auto& parameters = static_cast<juce::AudioProcessor&>(offlineProcessor).getParameters();
+
+            for (int i = 0; i < 64; ++i)
+            {
+                juce::String changed;
+
+                if (i % 4 == 0)
+                {
+                    auto* parameter = parameters[random.nextInt(parameters.size())];
+                    parameter->setValueNotifyingHost(random.nextFloat());
+                    changed << parameter->getName(64);
+                }
+
+                expectEquals(processAndCount(offlineProcessor, offlineBuffer, maximumBlockSize, midiMessages, random), 0, "offline, after changing " + changed);
+            }
+
+            offlineProcessor.releaseResources();
+        }
+    }
+
+private:
+    /** Processes one block of noise, and returns how many allocations it made. */
+    static int processAndCount(AudioPluginAudioProcessor& processor, juce::AudioBuffer<float>& buffer, int numSamples, juce::MidiBuffer& midiMessages, juce::Random& random)
+    {
+        juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), numSamples);
+
+        for (int channel = 0; channel < block.getNumChannels(); ++channel)
+            for (int sample = 0; sample < numSamples; ++sample)
+                block.setSample(channel, sample, (random.nextFloat() * 2.0f) - 1.0f);
+
+        numAllocations = 0;
+        isCountingAllocations = true;
+
+        processor.processBlock(block, midiMessages);
+
+        isCountingAllocations = false;
+
+        return numAllocations;
+    }
+};
+
+static AllocationTests allocationTests;
+
+  /// @} group Biquads
+} // namespace Biquads
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,142 @@
+/***************************************************************************//**
+ * @file BatchDesignTests.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Checks the batch coefficient design, and its polynomials, against the single-filter design.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include <vector>
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Biquads {
+/** @addtogroup Biquads @{ */
+
+//==============================================================================
+// The batch design works out the trigonometry and the gain with polynomials,
+// where the single-filter design calls the standard library; the two should
+// agree to within the accuracy that the polynomials promise.
+class BatchDesignTests : public juce::UnitTest
+{
+public:
+    BatchDesignTests() : juce::UnitTest("Batch design", "StoneyDSP") {}
+
+    void runTest() override
+    {
+        using Functions = StoneyDSP::Maths::Functions<double>;
+
+        beginTest("sinCos() is within 1e-11 of the standard library over [0, pi]");
+        {
+            double worstError = 0.0;
+
+            for (int i = 0; i <= 100000; ++i)
+            {
+                const auto x = juce::MathConstants<double>::pi * static_cast<double>(i) / 100000.0;
+                double sin, cos;
+                Functions::sinCos(x, sin, cos);
+
+                worstError = std::max({ worstError, std::abs(sin - std::sin(x)), std::abs(cos - std::cos(x)) });
+            }
+
+            expectLessOrEqual(worstError, 1e-11);
+        }
+
+        beginTest("exp() is within 1e-9 of the standard library, relatively, over [-8, 8]");
+        {
+            double worstError = 0.0;
+
+            for (int i = -100000; i <= 100000; ++i)
+            {
+                const auto x = 8.0 * static_cast<double>(i) / 100000.0;
+                worstError = std::max(worstError, std::abs(Functions::exp(x) - std::exp(x)) / std::exp(x));
+            }
+
+            expectLessOrEqual(worstError, 1e-9);
+        }
+
+        beginTest("Every type designs the same in a batch as on its own");
+        {
+            // Not a multiple of the batch's chunk size, so that the last
+            // chunk is a short one.
+            runTypes<double>(200, 1e-9);
+            runTypes<float> (200, 3e-5);
+        }
+    }
+
+private:
+    template <typename SampleType>
+    void runTypes(std::size_t numFilters, double tolerance)
+    {
+        using filterType = StoneyDSP::Audio::BiquadsFilterType;
+        using coefficientsType = StoneyDSP::Audio::BiquadsCoefficients<SampleType>;
+
+        constexpr double sampleRate = 48000.0;
+        auto random = getRandom();
+
+        for (int typeIndex = 0; typeIndex <= static_cast<int>(filterType::allPass); ++typeIndex)
+        {
+            const auto type = static_cast<filterType>(typeIndex);
+
+            std::vector<filterType> types(numFilters, type);
+            std::vector<SampleType> frequencies(numFilters), resonances(numFilters), gains(numFilters);
+            std::vector<coefficientsType> coefficients(numFilters);
+
+            // 20Hz to 20kHz, every resonance, and the Gain parameter's range.
+            for (std::size_t i = 0; i < numFilters; ++i)
+            {
+                frequencies[i] = static_cast<SampleType>(20.0 * std::pow(1000.0, random.nextDouble()));
+                resonances[i]  = static_cast<SampleType>(random.nextDouble());
+                gains[i]       = static_cast<SampleType>((random.nextDouble() * 48.0) - 24.0);
+            }
+
+            StoneyDSP::Audio::Biquads<SampleType>::calculateCoefficients(types.data(), frequencies.data(), resonances.data(), gains.data(), coefficients.data(), numFilters, sampleRate);
+
+            // Relative to the size of the coefficient, for the larger gains.
+            const auto getError = [] (SampleType batch, SampleType single)
+            {
+                return std::abs(static_cast<double>(batch - single)) / std::max(1.0, std::abs(static_cast<double>(single)));
+            };
+
+            double worstError = 0.0;
+
+            for (std::size_t i = 0; i < numFilters; ++i)
+            {
+                const auto single = StoneyDSP::Audio::Biquads<SampleType>::calculateCoefficients(type, frequencies[i], resonances[i], gains[i], sampleRate);
+                const auto& batch = coefficients[i];
+
+                worstError = std::max({ worstError, getError(batch.b0, single.b0), getError(batch.b1, single.b1), getError(batch.b2, single.b2),
+                                                    getError(batch.a1, single.a1), getError(batch.a2, single.a2) });
+            }
+
+            expectLessOrEqual(worstError, tolerance, "type " + juce::String(typeIndex) + (sizeof(SampleType) == sizeof(float) ? ", float" : ", double"));
+        }
+    }
+};
+
+static BatchDesignTests batchDesignTests;
+
+  /// @} group Biquads
+} // namespace Biquads
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
@@ -0,0 +1,169 @@
+/***************************************************************************//**
+ * @file CascadeTests.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Checks the cutoff and the slope of every steep filter.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include <array>
+#include <complex>
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Biquads {
+/** @addtogroup Biquads @{ */
+
+//==============================================================================
+// The response of each chain of sections, worked out from its coefficients. A
+// Butterworth filter is 3dB down at its cutoff, a Linkwitz-Riley filter 6dB,
+// and both fall away at the slope they were asked for.
+class CascadeTests : public juce::UnitTest
+{
+public:
+    CascadeTests() : juce::UnitTest("Cascade", "StoneyDSP") {}
+
+    void runTest() override
+    {
+        using responseType = StoneyDSP::Audio::BiquadsCascadeResponse;
+
+        beginTest("Butterworth, 12 to 96dB/oct: -3dB at the cutoff, and the slope");
+        {
+            for (int slope = 12; slope <= cascadeType::maxSlope; slope += 6)
+                runSlope(responseType::butterworth, slope, -3.01);
+        }
+
+        beginTest("Linkwitz-Riley, 24, 48 and 96dB/oct: -6dB at the cutoff, and the slope");
+        {
+            for (const auto slope : { 24, 48, 96 })
+                runSlope(responseType::linkwitzRiley, slope, -6.02);
+        }
+
+        beginTest("The cascade filters as its sections do");
+        {
+            runImpulse();
+        }
+    }
+
+private:
+    using cascadeType = StoneyDSP::Audio::BiquadsCascade<double>;
+    using filterType = StoneyDSP::Audio::BiquadsFilterType;
+    using coefficientsType = StoneyDSP::Audio::BiquadsCoefficients<double>;
+
+    static constexpr double sampleRate = 48000.0;
+
+    /** Returns the response of a chain of sections at one frequency, in dB. */
+    static double getDecibels(const coefficientsType* sections, int numSections, double frequency)
+    {
+        const auto z = std::polar(1.0, -juce::MathConstants<double>::twoPi * frequency / sampleRate);
+        std::complex<double> response(1.0);
+
+        for (int i = 0; i < numSections; ++i)
+        {
+            const auto& section = sections[i];
+            response *= (section.b0 + (section.b1 * z) + (section.b2 * z * z)) / (1.0 - (section.a1 * z) - (section.a2 * z * z));
+        }
+
+        return juce::Decibels::gainToDecibels(std::abs(response), -1000.0);
+    }
+
+    void runSlope(StoneyDSP::Audio::BiquadsCascadeResponse response, int slope, double decibelsAtCutoff)
+    {
+        std::array<coefficientsType, cascadeType::maxSections> sections;
+
+        for (const auto type : { filterType::lowPass2, filterType::highPass2 })
+        {
+            const auto isHighPass = type == filterType::highPass2;
+            const auto name = juce::String(isHighPass ? "high-pass, " : "low-pass, ") + juce::String(slope) + "dB/oct";
+
+            const auto cutoff = isHighPass ? 4000.0 : 250.0;
+            const auto numSections = cascadeType::calculateSections(type, response, cutoff, slope, sampleRate, sections.data());
+
+            expectLessOrEqual(numSections, cascadeType::maxSections, name + ", sections");
+            expectWithinAbsoluteError(getDecibels(sections.data(), numSections, cutoff), decibelsAtCutoff, 0.01, name + ", at the cutoff");
+
+            // An octave of the analog prototype, two octaves past the cutoff,
+            // where it is already on its asymptote: the bilinear transform
+            // maps the analog frequency tan(pi f / fs) to f.
+            const auto pi   = juce::MathConstants<double>::pi;
+            const auto near = isHighPass ? cutoff / 4.0 : cutoff * 4.0;
+            const auto far  = std::atan(std::tan(pi * near / sampleRate) * (isHighPass ? 0.5 : 2.0)) * sampleRate / pi;
+            const auto decibelsPerOctave = getDecibels(sections.data(), numSections, near) - getDecibels(sections.data(), numSections, far);
+
+            // Each 6dB/oct of the slope is one pole: 20 log10(2) per octave.
+            const auto expectedDecibelsPerOctave = juce::Decibels::gainToDecibels(2.0) * static_cast<double>(slope) / 6.0;
+            expectWithinAbsoluteError(decibelsPerOctave, expectedDecibelsPerOctave, 0.05, name + ", per octave");
+        }
+    }
+
+    void runImpulse()
+    {
+        constexpr int numSamples = 256;
+
+        cascadeType cascade;
+        juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32>(numSamples), 1 };
+        cascade.prepare(spec);
+        cascade.setParameters(filterType::lowPass2, StoneyDSP::Audio::BiquadsCascadeResponse::butterworth, 1000.0, cascadeType::maxSlope);
+
+        std::array<double, numSamples> samples {};
+        samples[0] = 1.0;
+
+        double* channels[] = { samples.data() };
+        juce::dsp::AudioBlock<double> block(channels, 1, static_cast<std::size_t>(numSamples));
+        cascade.process(juce::dsp::ProcessContextReplacing<double>(block));
+
+        // The same impulse, through each section in turn.
+        std::array<double, numSamples> expected {};
+        expected[0] = 1.0;
+
+        for (int i = 0; i < cascade.getNumSections(); ++i)
+        {
+            const auto& section = cascade.getSection(i);
+            double s1 = 0.0, s2 = 0.0;
+
+            for (auto& sample : expected)
+            {
+                const auto x = sample;
+                const auto y = (x * section.b0) + s1;
+                s1 = (x * section.b1) + s2 + (y * section.a1);
+                s2 = (x * section.b2) + (y * section.a2);
+                sample = y;
+            }
+        }
+
+        double worstError = 0.0;
+
+        for (std::size_t n = 0; n < samples.size(); ++n)
+            worstError = std::max(worstError, std::abs(samples[n] - expected[n]));
+
+        expectEquals(cascade.getNumSections(), cascadeType::maxSections);
+        expectLessOrEqual(worstError, 1e-12);
+    }
+};
+
+static CascadeTests cascadeTests;
+
+  /// @} group Biquads
+} // namespace Biquads
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
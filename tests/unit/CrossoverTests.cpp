@@ -0,0 +1,201 @@
+/***************************************************************************//**
+ * @file CrossoverTests.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Checks that the crossover's bands sum back to a flat response.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include <complex>
+#include <vector>
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Biquads {
+/** @addtogroup Biquads @{ */
+
+//==============================================================================
+// The impulse response of every band, and of their sum, measured at
+// frequencies across the audio band. The sum of Linkwitz-Riley bands is an
+// allpass, so its magnitude is 1 everywhere; each pair of neighbouring bands
+// meets 6dB down at the crossover between them.
+class CrossoverTests : public juce::UnitTest
+{
+public:
+    CrossoverTests() : juce::UnitTest("Crossover", "StoneyDSP") {}
+
+    void runTest() override
+    {
+        using crossoverType = StoneyDSP::Audio::BiquadsCrossover<double>;
+
+        for (const auto slope : { 24, 48 })
+        {
+            beginTest("LR" + juce::String(slope / 6) + " bands sum flat, and meet at -6dB");
+
+            for (int numBands = crossoverType::minBands; numBands <= crossoverType::maxBands; ++numBands)
+                runImpulse(numBands, slope);
+        }
+
+        beginTest("The pool splits every channel as the audio thread would");
+        {
+            runPool<float> (4, 24);
+            runPool<double>(6, 48);
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int numSamples = 16384;
+
+    /** Returns the response of an impulse response at one frequency. */
+    static std::complex<double> getResponse(const double* impulse, double frequency)
+    {
+        std::complex<double> sum;
+
+        for (int n = 0; n < numSamples; ++n)
+            sum += impulse[n] * std::polar(1.0, -juce::MathConstants<double>::twoPi * frequency * static_cast<double>(n) / sampleRate);
+
+        return sum;
+    }
+
+    void runImpulse(int numBands, int slope)
+    {
+        StoneyDSP::Audio::BiquadsCrossover<double> crossover;
+        crossover.setNumBands(numBands);
+        crossover.setSlope(slope);
+
+        // Two octaves apart, so that each crossover is far enough from the
+        // next for the two bands either side of it to meet at -6dB.
+        for (int index = 0; index < numBands - 1; ++index)
+            crossover.setCrossoverFrequency(index, 40.0 * std::pow(4.0, static_cast<double>(index)));
+
+        crossover.prepare({ sampleRate, static_cast<juce::uint32>(numSamples), 1 });
+
+        juce::AudioBuffer<double> input(1, numSamples);
+        input.clear();
+        input.setSample(0, 0, 1.0);
+
+        juce::AudioBuffer<double> bands(numBands, numSamples);
+        std::vector<juce::dsp::AudioBlock<double>> bandBlocks;
+
+        for (int band = 0; band < numBands; ++band)
+            bandBlocks.emplace_back(bands.getArrayOfWritePointers() + band, 1, static_cast<std::size_t>(numSamples));
+
+        crossover.process(juce::dsp::AudioBlock<const double>(input), bandBlocks.data());
+
+        std::vector<double> sum(numSamples, 0.0);
+
+        for (int band = 0; band < numBands; ++band)
+            for (int n = 0; n < numSamples; ++n)
+                sum[static_cast<std::size_t>(n)] += bands.getSample(band, n);
+
+        const auto name = juce::String(numBands) + " bands, " + juce::String(slope) + "dB/oct";
+
+        // Flat to within 0.01dB, from 20Hz to 20kHz.
+        double worstSumError = 0.0;
+
+        for (int i = 0; i <= 60; ++i)
+        {
+            const auto frequency = 20.0 * std::pow(1000.0, static_cast<double>(i) / 60.0);
+            worstSumError = std::max(worstSumError, std::abs(juce::Decibels::gainToDecibels(std::abs(getResponse(sum.data(), frequency)))));
+        }
+
+        expectLessOrEqual(worstSumError, 0.01, name + ", sum");
+
+        for (int index = 0; index < numBands - 1; ++index)
+        {
+            const auto frequency = static_cast<double>(crossover.getCrossoverFrequency(index));
+
+            for (const auto band : { index, index + 1 })
+            {
+                const auto decibels = juce::Decibels::gainToDecibels(std::abs(getResponse(bands.getReadPointer(band), frequency)));
+                expectWithinAbsoluteError(decibels, -6.02, 0.1, name + ", band " + juce::String(band) + " at crossover " + juce::String(index));
+            }
+        }
+    }
+
+    template <typename SampleType>
+    void runPool(int numChannels, int slope)
+    {
+        constexpr int blockSize = 512;
+        constexpr int numBands = StoneyDSP::Audio::BiquadsCrossover<SampleType>::maxBands;
+
+        StoneyDSP::Audio::BiquadsCrossover<SampleType> direct, pooled;
+
+        for (auto* crossover : { &direct, &pooled })
+        {
+            crossover->setNumBands(numBands);
+            crossover->setSlope(slope);
+            crossover->prepare({ sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels) });
+        }
+
+        juce::AudioBuffer<SampleType> input(numChannels, blockSize);
+        auto random = getRandom();
+
+        std::vector<juce::AudioBuffer<SampleType>> directBands, pooledBands;
+        std::vector<juce::dsp::AudioBlock<SampleType>> directBlocks, pooledBlocks;
+
+        for (int band = 0; band < numBands; ++band)
+        {
+            directBands.emplace_back(numChannels, blockSize);
+            pooledBands.emplace_back(numChannels, blockSize);
+        }
+
+        for (int band = 0; band < numBands; ++band)
+        {
+            directBlocks.emplace_back(directBands[static_cast<std::size_t>(band)]);
+            pooledBlocks.emplace_back(pooledBands[static_cast<std::size_t>(band)]);
+        }
+
+        juce::ThreadPool pool;
+        double worstError = 0.0;
+
+        // Several blocks, so that each job is reused and carries its
+        // channel's state over.
+        for (int block = 0; block < 8; ++block)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                for (int n = 0; n < blockSize; ++n)
+                    input.setSample(channel, n, static_cast<SampleType>((random.nextFloat() * 2.0f) - 1.0f));
+
+            const juce::dsp::AudioBlock<const SampleType> inputBlock(input);
+
+            direct.process(inputBlock, directBlocks.data());
+            pooled.process(inputBlock, pooledBlocks.data(), pool);
+
+            for (int band = 0; band < numBands; ++band)
+                for (int channel = 0; channel < numChannels; ++channel)
+                    for (int n = 0; n < blockSize; ++n)
+                        worstError = std::max(worstError, static_cast<double>(std::abs(directBands[static_cast<std::size_t>(band)].getSample(channel, n) - pooledBands[static_cast<std::size_t>(band)].getSample(channel, n))));
+        }
+
+        expectEquals(worstError, 0.0);
+    }
+};
+
+static CrossoverTests crossoverTests;
+
+  /// @} group Biquads
+} // namespace Biquads
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
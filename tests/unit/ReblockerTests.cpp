@@ -0,0 +1,166 @@
+/***************************************************************************//**
+ * @file ReblockerTests.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Checks that re-blocking changes nothing but the latency.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include <vector>
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Biquads {
+/** @addtogroup Biquads @{ */
+
+//==============================================================================
+// Two bands of filtering, run through a Reblocker in blocks of random size,
+// against the same bands run over the whole signal at once. The filters keep
+// state from one block to the next, so a sample lost, repeated or moved shows
+// up in every sample after it.
+class ReblockerTests : public juce::UnitTest
+{
+public:
+    ReblockerTests() : juce::UnitTest("Reblocker", "StoneyDSP") {}
+
+    void runTest() override
+    {
+        beginTest("Splitting host blocks matches processing them whole");
+        {
+            runReblocked<float> (64, false);
+            runReblocked<double>(64, false);
+            runReblocked<float> (17, false);
+        }
+
+        beginTest("The FIFO delays by exactly one block, and changes nothing else");
+        {
+            runReblocked<float> (64, true);
+            runReblocked<double>(64, true);
+            runReblocked<float> (17, true);
+        }
+
+        beginTest("A block size of 0 passes host blocks straight through");
+        {
+            runReblocked<float>(0, false);
+            runReblocked<float>(0, true);
+        }
+    }
+
+private:
+    static constexpr int numChannels = 2;
+    static constexpr int numSamples = 8192;
+    static constexpr int maximumBlockSize = 1024;
+
+    template <typename SampleType>
+    struct Bands
+    {
+        explicit Bands(int blockSize)
+        {
+            juce::dsp::ProcessSpec spec { 48000.0, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels) };
+
+            for (std::size_t band = 0; band < biquads.size(); ++band)
+            {
+                biquads[band].prepare(spec);
+                biquads[band].setParameters(StoneyDSP::Audio::BiquadsFilterType::peak, static_cast<SampleType>(200.0 * static_cast<double>(band + 1)), static_cast<SampleType>(0.7), static_cast<SampleType>(6.0));
+                biquads[band].reset(static_cast<SampleType>(0.0));
+            }
+        }
+
+        void process(juce::AudioBuffer<SampleType>& buffer)
+        {
+            juce::dsp::AudioBlock<SampleType> block(buffer);
+            juce::dsp::ProcessContextReplacing<SampleType> context(block);
+
+            for (auto& biquad : biquads)
+                biquad.process(context);
+        }
+
+        std::array<StoneyDSP::Audio::Biquads<SampleType>, 2> biquads;
+    };
+
+    template <typename SampleType>
+    void runReblocked(std::size_t blockSize, bool isFixedLatency)
+    {
+        juce::AudioBuffer<SampleType> expected(numChannels, numSamples);
+        fillWithNoise(expected);
+
+        auto actual = expected;
+
+        // The whole signal at once...
+        Bands<SampleType> reference(numSamples);
+        reference.process(expected);
+
+        // ...against blocks of 1 to maximumBlockSize samples, re-blocked.
+        StoneyDSP::Core::Arena arena;
+        arena.prepare(StoneyDSP::Audio::Reblocker<SampleType>::getArenaSize(numChannels, blockSize, isFixedLatency));
+
+        StoneyDSP::Audio::Reblocker<SampleType> reblocker;
+        reblocker.prepare(numChannels, blockSize, isFixedLatency, arena);
+
+        Bands<SampleType> bands(maximumBlockSize);
+        auto random = getRandom();
+
+        for (int start = 0; start < numSamples;)
+        {
+            const auto length = std::min(random.nextInt({ 1, maximumBlockSize + 1 }), numSamples - start);
+
+            juce::AudioBuffer<SampleType> hostBlock(actual.getArrayOfWritePointers(), numChannels, start, length);
+            reblocker.process(hostBlock, [&bands](juce::AudioBuffer<SampleType>& block) { bands.process(block); });
+
+            start += length;
+        }
+
+        const auto latency = reblocker.getLatencySamples();
+        expectEquals(latency, isFixedLatency ? static_cast<int>(blockSize) : 0);
+
+        double worstError = 0.0;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                const auto wanted = sample < latency ? SampleType() : expected.getSample(channel, sample - latency);
+                worstError = std::max(worstError, static_cast<double>(std::abs(actual.getSample(channel, sample) - wanted)));
+            }
+        }
+
+        expectEquals(worstError, 0.0, "block size " + juce::String(static_cast<int>(blockSize)) + (isFixedLatency ? ", FIFO" : ", split"));
+    }
+
+    template <typename SampleType>
+    void fillWithNoise(juce::AudioBuffer<SampleType>& buffer)
+    {
+        auto random = getRandom();
+
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+                buffer.setSample(channel, sample, static_cast<SampleType>((random.nextFloat() * 2.0f) - 1.0f));
+    }
+};
+
+static ReblockerTests reblockerTests;
+
+  /// @} group Biquads
+} // namespace Biquads
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
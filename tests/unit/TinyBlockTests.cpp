@@ -0,0 +1,172 @@
+/***************************************************************************//**
+ * @file TinyBlockTests.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Checks that the fast path for tiny blocks sounds like the full path.
+ * @version 1.2.2.174
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2024 - Nathan J. Hood
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include "StoneyDSP/Biquads.hpp"
+
+#include <functional>
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP @{ */
+
+namespace Biquads {
+/** @addtogroup Biquads @{ */
+
+//==============================================================================
+// Two processors with the same settings and the same input: one in blocks of
+// 512 samples, which always take the full path, and one in blocks of 1 to 32
+// samples, which take the fast path once the first block has been through the
+// full one.
+class TinyBlockTests : public juce::UnitTest
+{
+public:
+    TinyBlockTests() : juce::UnitTest("Tiny blocks", "StoneyDSP") {}
+
+    void runTest() override
+    {
+        beginTest("The default settings");
+        {
+            runAgainstFullPath([](juce::AudioProcessorValueTreeState&) {}, true);
+        }
+
+        beginTest("Every band, the mix and the output");
+        {
+            runAgainstFullPath([](juce::AudioProcessorValueTreeState& apvts)
+            {
+                // LP2, HP2, BP2, LS2, HS2 and PK2, around the bands.
+                constexpr int types[] = { 0, 2, 4, 6, 9, 12 };
+
+                for (std::size_t band = 0; band < AudioPluginAudioProcessorParameters::numBands; ++band)
+                {
+                    setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(band, "bypass"),    0.0f);
+                    setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(band, "frequency"), 100.0f * static_cast<float>(band + 1) * static_cast<float>(band + 1));
+                    setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(band, "resonance"), 0.3f);
+                    setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(band, "gain"),      band % 2 == 0 ? 6.0f : -6.0f);
+                    setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(band, "type"),      static_cast<float>(types[band % std::size(types)]));
+                }
+
+                setParameter(apvts, "Master_mixID", 70.0f);
+                setParameter(apvts, "Master_outputID", -3.0f);
+            }, true);
+        }
+
+        beginTest("A steep slope and each transform");
+        {
+            for (int transform = 0; transform < 4; ++transform)
+            {
+                runAgainstFullPath([transform](juce::AudioProcessorValueTreeState& apvts)
+                {
+                    setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(0, "type"),  0.0f);
+                    setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(0, "slope"), 3.0f);
+                    setParameter(apvts, "Master_transformID", static_cast<float>(transform));
+                }, true);
+            }
+        }
+
+        // A modulated band needs the full path; the two must still agree.
+        beginTest("An LFO keeps tiny blocks on the full path");
+        {
+            runAgainstFullPath([](juce::AudioProcessorValueTreeState& apvts)
+            {
+                setParameter(apvts, AudioPluginAudioProcessorParameters::getBandParameterID(0, "lfoDepth"), 1.0f);
+            }, false);
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int maximumBlockSize = 512;
+    static constexpr int numSamples = 16384;
+
+    static void setParameter(juce::AudioProcessorValueTreeState& apvts, const juce::String& parameterID, float value)
+    {
+        auto* parameter = apvts.getParameter(parameterID);
+        jassert(parameter != nullptr);
+
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    void runAgainstFullPath(const std::function<void(juce::AudioProcessorValueTreeState&)>& setParameters, bool shouldUseTinyBlockPath)
+    {
+        AudioPluginAudioProcessor full, tiny;
+
+        setParameters(full.getApvts());
+        setParameters(tiny.getApvts());
+
+        full.prepareToPlay(sampleRate, maximumBlockSize);
+        tiny.prepareToPlay(sampleRate, maximumBlockSize);
+
+        const auto numChannels = std::max(full.getTotalNumInputChannels(), full.getTotalNumOutputChannels());
+
+        juce::AudioBuffer<float> expected(numChannels, numSamples);
+        auto random = getRandom();
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int sample = 0; sample < numSamples; ++sample)
+                expected.setSample(channel, sample, (random.nextFloat() * 2.0f) - 1.0f);
+
+        auto actual = expected;
+        juce::MidiBuffer midiMessages;
+
+        for (int start = 0; start < numSamples; start += maximumBlockSize)
+        {
+            juce::AudioBuffer<float> block(expected.getArrayOfWritePointers(), numChannels, start, std::min(maximumBlockSize, numSamples - start));
+            full.processBlock(block, midiMessages);
+        }
+
+        bool tookTinyBlockPath = false;
+
+        for (int start = 0; start < numSamples;)
+        {
+            const auto length = std::min(random.nextInt({ 1, 33 }), numSamples - start);
+
+            tookTinyBlockPath = tookTinyBlockPath || tiny.isUsingTinyBlockPath();
+
+            juce::AudioBuffer<float> block(actual.getArrayOfWritePointers(), numChannels, start, length);
+            tiny.processBlock(block, midiMessages);
+
+            start += length;
+        }
+
+        expect(tookTinyBlockPath == shouldUseTinyBlockPath, shouldUseTinyBlockPath ? "the fast path was never taken" : "the fast path was taken");
+
+        double worstError = 0.0;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int sample = 0; sample < numSamples; ++sample)
+                worstError = std::max(worstError, static_cast<double>(std::abs(actual.getSample(channel, sample) - expected.getSample(channel, sample))));
+
+        expectLessOrEqual(worstError, 1.0e-5);
+
+        full.releaseResources();
+        tiny.releaseResources();
+    }
+};
+
+static TinyBlockTests tinyBlockTests;
+
+  /// @} group Biquads
+} // namespace Biquads
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP